@@ -0,0 +1,122 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/AdvanceTable.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_ADVANCETABLE_H_
+#define CPPFREETYPE_ADVANCETABLE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// advance widths of every glyph of a face at its active size
+/**
+ *  Advances are read with FT_Get_Advances and FT_LOAD_ADVANCE_ONLY, a page
+ *  of 256 glyphs at a time the first time a glyph of the page is asked for,
+ *  so large CJK fonts only pay for the pages they use. After that a lookup
+ *  is an array load and never touches the glyph slot.
+ *
+ *  Values are 26.6 pixels, or font units if the load flags contain
+ *  FT_LOAD_NO_SCALE. With FT_LOAD_NO_HINTING FreeType reads the advances
+ *  straight from the metrics tables, hinted advances may require FreeType
+ *  to load each glyph once while filling a page.
+ *
+ *  The table follows the face's active size: when the size metrics change
+ *  every page is dropped and refilled on demand.
+ */
+class AdvanceTable
+{
+    public:
+        static const UInt PAGE_BITS = 8;
+        static const UInt PAGE_SIZE = 1 << PAGE_BITS;
+
+    private:
+        RefPtr<Face>        m_face;
+        Int32               m_load_flags;
+        UInt                m_num_glyphs;
+        std::vector<Int32>  m_advances;     ///< one per glyph
+        std::vector<Byte>   m_loaded;       ///< one per page
+        UInt                m_pages_loaded;
+        Fixed               m_x_scale;      ///< size the pages are for
+        Fixed               m_y_scale;
+        Error               m_error;        ///< first error filling a page
+                                            ///  since clear_error()
+
+        /// not copy-constructable
+        AdvanceTable( const AdvanceTable& );
+
+        /// not copy-assignable
+        AdvanceTable& operator=( const AdvanceTable& );
+
+        /// drop every page if the active size changed
+        void sync();
+
+        /// read the advances of page @p page
+        void fill_page( UInt page );
+
+    public:
+        /// a table for the advances of @p face loaded with @p load_flags,
+        /// FT_LOAD_ADVANCE_ONLY is added to the flags
+        explicit AdvanceTable( RefPtr<Face>& face, Int32 load_flags = 0 );
+
+        /// advance of @p glyph_index, 0 if there is no such glyph
+        Int32 advance( UInt glyph_index );
+
+        /// sum of the advances of @p count glyphs
+        /**
+         *  Missing pages are filled first, then the advances are summed
+         *  with AVX2 gathers, eight glyphs at a time, when the compiler
+         *  targets AVX2.
+         */
+        Long measure( const UInt* glyph_indices, size_t count );
+
+        /// read every page now
+        void fill();
+
+        /// drop every page and the error
+        void invalidate();
+
+        /// the load flags advances are read with
+        Int32 load_flags() const;
+
+        /// number of pages read so far
+        UInt pages_loaded() const;
+
+        /// the first error met while reading advances since the last
+        /// clear_error() or invalidate(), pages which failed read as zero
+        /// and are read again the next time they are needed
+        Error error() const;
+
+        /// forget the error, e.g. before a call whose errors are wanted
+        void clear_error();
+};
+
+} // namespace freetype
+
+#endif // ADVANCETABLE_H_
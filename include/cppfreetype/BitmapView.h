@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/BitmapView.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_BITMAPVIEW_H_
+#define CPPFREETYPE_BITMAPVIEW_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cppfreetype/types.h>
+
+namespace freetype {
+
+/// read-only view of the pixels of an FT_Bitmap
+/**
+ *  The fields are those of the bitmap, so taking a view copies no pixel.
+ *  As in FreeType, a negative pitch means the bitmap flows upward and
+ *  @p buffer is the bottom row, row() hides the difference.
+ *
+ *  The view points into the bitmap and is invalidated when the glyph slot
+ *  it came from is loaded again. Use CachedGlyph to keep a copy.
+ */
+struct BitmapView
+{
+    const Byte* buffer;     ///< first byte in memory
+    Int         width;      ///< pixels per row, subpixels for LCD
+    Int         rows;       ///< number of rows, subpixel rows for LCD_V
+    Int         pitch;      ///< bytes from one row to the next in memory,
+                            ///  negative if the bitmap flows upward
+    Byte        pixel_mode; ///< pixelmode::PixelMode
+    UShort      num_grays;  ///< gray levels of a GRAY bitmap
+
+    /// an empty view
+    BitmapView();
+
+    /// a view of @p bitmap
+    explicit BitmapView( const FT_Bitmap& bitmap );
+
+    /// whether there is no pixel to see
+    bool empty() const { return !buffer || width <= 0 || rows <= 0; }
+
+    /// bytes per row, whatever the flow
+    Int stride() const { return pitch < 0 ? -pitch : pitch; }
+
+    /// row @p j, counted from the top
+    const Byte* row( Int j ) const
+    {
+        return pitch < 0 ? buffer + (ptrdiff_t)( rows - 1 - j ) * -pitch
+                         : buffer + (ptrdiff_t)j * pitch;
+    }
+
+    /// coverage of pixel @p i of row @p j, 0 to 255, see blit_to()
+    Byte coverage( Int i, Int j ) const;
+
+    /// write the coverage of the bitmap into an 8 bit image
+    /**
+     *  Each pixel is expanded to one byte from 0 to 255: MONO pixels to 0
+     *  or 255, GRAY2, GRAY4 and GRAY levels scaled to the full range, LCD
+     *  and LCD_V subpixels copied as they are and BGRA pixels to their
+     *  alpha. The part of the bitmap outside of the image is clipped.
+     *
+     *  @param[in]  dst         top row of the image
+     *  @param[in]  dst_pitch   bytes from one row of the image to the next,
+     *                          negative if it flows upward
+     *  @param[in]  dst_width   width of the image in pixels
+     *  @param[in]  dst_rows    height of the image in pixels
+     *  @param[in]  x           column of the image for the left edge of
+     *                          the bitmap, may be negative
+     *  @param[in]  y           row of the image for the top row of the
+     *                          bitmap, may be negative
+     */
+    void blit_to( Byte* dst, Int dst_pitch, Int dst_width, Int dst_rows,
+                  Int x, Int y ) const;
+};
+
+} // namespace freetype
+
+#endif // BITMAPVIEW_H_
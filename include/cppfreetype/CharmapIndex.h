@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/CharmapIndex.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_CHARMAPINDEX_H_
+#define CPPFREETYPE_CHARMAPINDEX_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// a flat copy of a face's active charmap for constant time lookups
+/**
+ *  FT_Get_Char_Index searches the cmap subtables on every call. The index
+ *  enumerates the charmap once and stores it as a two level page table
+ *  over the whole Unicode range, with pages of 256 code points. Pages
+ *  without any mapped code point all share one empty page, so the table
+ *  costs 17 KiB plus 1 KiB for each page which is used. Latin-1 has its
+ *  own direct array, so the common case is a single load.
+ *
+ *  Character codes above LIMIT (only possible with non-Unicode charmaps)
+ *  are not indexed and look up as glyph 0.
+ *
+ *  The index is a snapshot, rebuild it if the face's charmap is changed.
+ */
+class CharmapIndex
+{
+    public:
+        /// one past the largest indexed character code
+        static const UInt32 LIMIT       = 0x110000;
+
+        /// code points per page
+        static const UInt32 PAGE_BITS   = 8;
+        static const UInt32 PAGE_SIZE   = 1 << PAGE_BITS;
+        static const UInt32 NUM_PAGES   = LIMIT >> PAGE_BITS;
+
+    private:
+        UInt                m_latin1[256];          ///< direct for < 256
+        UInt32              m_top[NUM_PAGES];       ///< page offsets into
+                                                    ///  m_glyphs
+        std::vector<UInt>   m_glyphs;               ///< pages, the first is
+                                                    ///  the empty page
+        size_t              m_size;                 ///< number of mapped
+                                                    ///  codes
+
+    public:
+        /// an empty index, every lookup returns 0
+        CharmapIndex();
+
+        /// enumerate the active charmap of @p face, replacing the contents
+        void build( RefPtr<Face>& face );
+
+        /// drop every mapping
+        void clear();
+
+        /// glyph index of @p char_code, 0 if it is not mapped
+        UInt lookup( ULong char_code ) const
+        {
+            if( char_code < 256 )
+                return m_latin1[char_code];
+            if( char_code >= LIMIT )
+                return 0;
+            return m_glyphs[ m_top[ char_code >> PAGE_BITS ]
+                             + ( char_code & (PAGE_SIZE-1) ) ];
+        }
+
+        /// glyph indices of @p count UTF-32 code points
+        /**
+         *  Uses AVX2 gathers, eight code points at a time, when the
+         *  compiler targets AVX2.
+         */
+        void lookup( const UInt32* char_codes, size_t count,
+                     UInt* glyph_indices ) const;
+
+        /// number of character codes which map to a glyph
+        size_t size() const;
+
+        /// number of non-empty pages
+        size_t num_pages() const;
+
+        /// bytes of memory used by the index
+        size_t bytes() const;
+};
+
+} // namespace freetype
+
+#endif // CHARMAPINDEX_H_
@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/CompactOutline.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_COMPACTOUTLINE_H_
+#define CPPFREETYPE_COMPACTOUTLINE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Outline.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// an owned, structure-of-arrays copy of an outline
+/**
+ *  The coordinates are split into separate x and y arrays and the tags are
+ *  normalized to exactly curve_tag::ON, CONIC or CUBIC (the dropout bits
+ *  are dropped), so that whole-glyph passes over the outline are simple
+ *  loops over contiguous arrays which the compiler can vectorize.
+ *
+ *  The copy survives further loads into the glyph slot it was taken from,
+ *  and reusing one CompactOutline for many glyphs reuses its storage.
+ */
+struct CompactOutline
+{
+    std::vector<Pos>    x;              ///< x coordinate of each point
+    std::vector<Pos>    y;              ///< y coordinate of each point
+    std::vector<Byte>   tags;           ///< curve_tag of each point
+    std::vector<Int>    contour_ends;   ///< one past the last point of each
+                                        ///  contour
+    Int                 flags;          ///< outline flags, FT_OUTLINE_XXX
+    Int                 n_on;           ///< number of on-curve points
+    Int                 n_conic;        ///< number of conic control points
+    Int                 n_cubic;        ///< number of cubic control points
+
+    CompactOutline();
+
+    /// copy and classify the points of @p view
+    void assign( const OutlineView& view );
+
+    /// copy and classify the points of @p outline
+    void assign( RefPtr<Outline> outline );
+
+    /// drop all points, keeping the storage
+    void clear();
+
+    Int n_points() const;
+    Int n_contours() const;
+
+    /// index of the first point of contour @p c
+    Int contour_begin( Int c ) const;
+
+    /// one past the index of the last point of contour @p c
+    Int contour_end( Int c ) const;
+
+    /// control box of the points, the same as FT_Outline_Get_CBox, all
+    /// zero for an empty outline
+    FT_BBox cbox() const;
+
+    /// normalize @p n raw FreeType tags to curve_tag values in @p out
+    /**
+     *  The loop is branch free so the compiler can vectorize it.
+     */
+    static void classify( const char* tags, Int n, Byte* out );
+
+    /// write 1 to @p out[i] for each on-curve point and 0 otherwise,
+    /// return the number of on-curve points
+    static Int on_mask( const Byte* tags, Int n, Byte* out );
+};
+
+} // namespace freetype
+
+#endif // COMPACTOUTLINE_H_
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/Coverage.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_COVERAGE_H_
+#define CPPFREETYPE_COVERAGE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// the set of character codes a face maps to a glyph, as a sparse bitmap
+/**
+ *  Codes are grouped in pages of 256 and only pages holding at least one
+ *  code are stored, as a sorted page number and a 256 bit mask, so a
+ *  Latin font costs a few hundred bytes and a CJK font a few KiB rather
+ *  than the 136 KiB of a flat Unicode bitmap.
+ */
+class Coverage
+{
+    public:
+        static const UInt PAGE_BITS = 8;
+        static const UInt PAGE_SIZE = 1 << PAGE_BITS;
+        static const UInt PAGE_WORDS = PAGE_SIZE / 64; ///< words per mask
+
+        typedef unsigned long long Word_t;
+
+    private:
+        std::vector<UInt32> m_pages;    ///< sorted page numbers
+        std::vector<Word_t> m_bits;     ///< PAGE_WORDS per page
+        size_t              m_count;    ///< number of codes
+
+        /// the mask of page @p page, NULL if it is empty
+        const Word_t* mask( UInt32 page ) const;
+
+    public:
+        /// an empty set
+        Coverage();
+
+        /// the codes of the active charmap of @p face, which FreeType
+        /// makes the Unicode one when the face has one
+        void build( RefPtr<Face>& face );
+
+        /// add one code, cheapest when codes are added in increasing order
+        void add( ULong charcode );
+
+        /// replace the set with @p n_pages pages, as returned by pages()
+        /// and bits()
+        void assign( const UInt32* pages, const Word_t* bits,
+                     size_t n_pages );
+
+        /// whether @p charcode is in the set
+        bool contains( ULong charcode ) const;
+
+        /// empty the set
+        void clear();
+
+        /// number of codes
+        size_t count() const;
+
+        /// number of non-empty pages
+        size_t num_pages() const;
+
+        /// sorted page numbers, num_pages() of them
+        const UInt32* pages() const;
+
+        /// PAGE_WORDS masks per page, bit i of word w of a page is code
+        /// ( page << PAGE_BITS ) + 64*w + i
+        const Word_t* bits() const;
+
+        /// approximate heap memory held
+        size_t bytes() const;
+};
+
+} // namespace freetype
+
+#endif // COVERAGE_H_
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/CoverageFilter.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_COVERAGEFILTER_H_
+#define CPPFREETYPE_COVERAGEFILTER_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/Coverage.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// a Bloom filter of the character codes a face maps
+/**
+ *  A filter answers "certainly not mapped" or "maybe mapped" for a
+ *  character code with a single memory load, so looking up a character
+ *  the face lacks, the common case for all but the last face of a
+ *  fallback list, never reaches FreeType. Each code sets NUM_HASHES bits
+ *  of one 64 bit word, chosen by a hash of the code.
+ *
+ *  The size is set by the bits spent per mapped code, rounded up to a
+ *  power of two words: 8 bits reject about 98% of missing codes, 16 bits
+ *  about 99.7%. Once attach()ed to a face,
+ *  FaceDelegate::get_char_index() returns 0 right away for codes which
+ *  the filter rejects. Changing the active charmap detaches it.
+ *
+ *  A filter can be built without opening the face from the Coverage kept
+ *  by a FontIndex, which is persisted with the rest of the face's
+ *  metadata.
+ */
+class CoverageFilter
+{
+    public:
+        typedef unsigned long long Word_t;
+
+        /// bits set by each code
+        static const UInt NUM_HASHES = 4;
+
+    private:
+        std::vector<Word_t> m_words;    ///< size is a power of two
+        size_t              m_count;    ///< number of codes added
+
+        /// the word of @p hash
+        size_t word( Word_t hash ) const
+        {
+            return ( hash >> 32 ) & ( m_words.size() - 1 );
+        }
+
+        /// the bits of @p hash within its word
+        static Word_t mask( Word_t hash )
+        {
+            Word_t bits = 0;
+            for( UInt i=0; i < NUM_HASHES; i++ )
+                bits |= (Word_t)1 << ( ( hash >> ( 6*i ) ) & 63 );
+            return bits;
+        }
+
+        /// mix the bits of @p char_code
+        static Word_t hash( ULong char_code )
+        {
+            Word_t h = char_code;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        /// size the filter for @p count codes
+        void reset( size_t count, UInt bits_per_code );
+
+        /// add one code
+        void add( ULong char_code );
+
+    public:
+        /// an empty filter, which rejects every code
+        CoverageFilter();
+
+        /// the codes of the active charmap of @p face
+        void build( RefPtr<Face>& face, UInt bits_per_code = 8 );
+
+        /// the codes of @p coverage
+        void build( const Coverage& coverage, UInt bits_per_code = 8 );
+
+        /// replace the filter with @p n_words words as returned by words(),
+        /// @p n_words must be a power of two
+        void assign( const Word_t* words, size_t n_words, size_t count );
+
+        /// false if @p char_code is certainly not in the set
+        bool may_contain( ULong char_code ) const
+        {
+            Word_t h    = hash( char_code );
+            Word_t bits = mask( h );
+            return ( m_words[ word(h) ] & bits ) == bits;
+        }
+
+        /// number of codes added
+        size_t count() const;
+
+        /// number of words
+        size_t num_words() const;
+
+        /// the words of the filter
+        const Word_t* words() const;
+
+        /// approximate heap memory held
+        size_t bytes() const;
+
+        /// make FaceDelegate::get_char_index() of @p face consult a copy
+        /// of this filter, replacing the one attached before
+        /**
+         *  The copy is stored in the generic field of the face and freed
+         *  with it.
+         *
+         *  @return FT_Err_Invalid_Argument, and leave the face alone, if
+         *          its generic field holds something other than a filter
+         */
+        Error attach( RefPtr<Face>& face ) const;
+
+        /// free the filter attached to @p face, if any
+        static void detach( FT_Face face );
+
+        /// the filter attached to @p face, or NULL
+        static const CoverageFilter* attached( FT_Face face );
+};
+
+} // namespace freetype
+
+#endif // COVERAGEFILTER_H_
@@ -0,0 +1,205 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/Decompose.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief  statically dispatched outline decomposition
+ */
+
+#ifndef CPPFREETYPE_DECOMPOSE_H_
+#define CPPFREETYPE_DECOMPOSE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Outline.h>
+
+namespace freetype {
+
+namespace decompose_detail
+{
+    inline FT_Vector midpoint( const FT_Vector& a, const FT_Vector& b )
+    {
+        FT_Vector mid;
+        mid.x = ( a.x + b.x ) / 2;
+        mid.y = ( a.y + b.y ) / 2;
+        return mid;
+    }
+}
+
+/// walk the contours of an outline, calling the path commands of
+/// @p visitor
+/**
+ *  This produces the same sequence of commands as FT_Outline_Decompose
+ *  (with no shift or delta) but calls the visitor's members directly, so
+ *  the whole walk can be inlined into the caller. The visitor must have
+ *  the members
+ *
+ *  @code
+struct Visitor
+{
+    Error move_to ( const FT_Vector& to );
+    Error line_to ( const FT_Vector& to );
+    Error conic_to( const FT_Vector& control, const FT_Vector& to );
+    Error cubic_to( const FT_Vector& control1, const FT_Vector& control2,
+                    const FT_Vector& to );
+};
+@endcode
+ *
+ *  Each member returns 0 to continue, any other value stops the walk and is
+ *  returned by decompose().
+ *
+ *  Two consecutive conic control points imply an on-curve point half way
+ *  between them, and a contour which starts on a conic control point starts
+ *  at the last point of the contour if it is on the curve, or at the
+ *  implied point between the first and last points otherwise. Every
+ *  contour ends with a segment back to its starting point.
+ *
+ *  @return 0 on success, FT_Err_Invalid_Outline if the outline is
+ *          malformed, or the first non-zero value returned by the visitor
+ */
+template <class Visitor>
+Error decompose( const OutlineView& outline, Visitor& visitor )
+{
+    using decompose_detail::midpoint;
+
+    const FT_Vector* points = outline.points;
+    Error            error  = 0;
+    Int              first  = 0;
+
+    for( Int c=0; c < outline.n_contours; c++ )
+    {
+        Int last = outline.contours[c];
+        if( last < first || last >= outline.n_points )
+            return FT_Err_Invalid_Outline;
+
+        Int       limit   = last;
+        Int       i       = first;
+        FT_Vector v_start = points[first];
+
+        if( outline.cubic(first) )
+            return FT_Err_Invalid_Outline;
+
+        if( outline.conic(first) )
+        {
+            // start at the last point if it is on the curve, otherwise at
+            // the point implied between the last and first controls
+            if( outline.on(last) )
+            {
+                v_start = points[last];
+                --limit;
+            }
+            else
+                v_start = midpoint( v_start, points[last] );
+
+            // the first point is then processed as a control point
+            --i;
+        }
+
+        if( ( error = visitor.move_to( v_start ) ) )
+            return error;
+
+        bool closed = false;
+        while( i < limit && !closed )
+        {
+            ++i;
+
+            if( outline.on(i) )
+            {
+                if( ( error = visitor.line_to( points[i] ) ) )
+                    return error;
+            }
+            else if( outline.conic(i) )
+            {
+                FT_Vector control = points[i];
+                while( true )
+                {
+                    if( i >= limit )
+                    {
+                        if( ( error = visitor.conic_to( control, v_start ) ) )
+                            return error;
+                        closed = true;
+                        break;
+                    }
+
+                    ++i;
+                    if( outline.on(i) )
+                    {
+                        if( ( error = visitor.conic_to( control, points[i] ) ) )
+                            return error;
+                        break;
+                    }
+
+                    if( !outline.conic(i) )
+                        return FT_Err_Invalid_Outline;
+
+                    // two controls in a row, emit up to the implied point
+                    FT_Vector middle = midpoint( control, points[i] );
+                    if( ( error = visitor.conic_to( control, middle ) ) )
+                        return error;
+                    control = points[i];
+                }
+            }
+            else
+            {
+                // cubic control points come in pairs
+                if( i + 1 > limit || !outline.cubic(i+1) )
+                    return FT_Err_Invalid_Outline;
+
+                const FT_Vector& control1 = points[i];
+                const FT_Vector& control2 = points[i+1];
+                i += 2;
+
+                if( i <= limit )
+                    error = visitor.cubic_to( control1, control2, points[i] );
+                else
+                {
+                    error  = visitor.cubic_to( control1, control2, v_start );
+                    closed = true;
+                }
+
+                if( error )
+                    return error;
+            }
+        }
+
+        if( !closed )
+        {
+            if( ( error = visitor.line_to( v_start ) ) )
+                return error;
+        }
+
+        first = last + 1;
+    }
+
+    return 0;
+}
+
+/// walk the contours of @p outline, see decompose( const OutlineView&,
+/// Visitor& )
+template <class Visitor>
+Error decompose( RefPtr<Outline> outline, Visitor& visitor )
+{
+    return decompose( outline->view(), visitor );
+}
+
+} // namespace freetype
+
+#endif // DECOMPOSE_H_
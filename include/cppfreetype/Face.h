@@ -40,6 +40,7 @@ namespace freetype
 
 
 class Face;
+struct GlyphBatch;
 
 /// c++ interface on top of c-object pointer
 class FaceDelegate
@@ -280,6 +281,30 @@ class FaceDelegate
                         ULong char_code,
                         Int32 load_flags );
 
+        /// Load a run of glyphs into a caller owned batch in one call.
+        /**
+         *  @param[in]  glyph_indices   the glyphs to load
+         *  @param[in]  count           number of glyph indices
+         *  @param[in]  load_flags      flags passed to FT_Load_Glyph for
+         *                              every glyph
+         *  @param[out] batch           receives the metrics and bitmap or
+         *                              outline of each distinct glyph,
+         *                              its previous contents are dropped
+         *
+         *  @return the first error met, 0 if every glyph loaded. A glyph
+         *          which fails to load does not stop the batch, its error
+         *          is recorded in its BatchGlyph.
+         *
+         *  Each distinct index is loaded once through the face's glyph
+         *  slot, repeated indices share the first load. The glyph slot is
+         *  left holding the last glyph loaded.
+         */
+        Error load_glyphs(
+                        const UInt*   glyph_indices,
+                        size_t        count,
+                        Int32         load_flags,
+                        GlyphBatch&   batch );
+
         /// Retrieve the ASCII name of a given glyph in a face. This only
         /// works for those faces where FT_HAS_GLYPH_NAMES(face) returns 1.
         /**
@@ -367,6 +392,9 @@ class FaceDelegate
          *  ‘.notdef’ glyph at all, then one will be created at index 0 and
          *  whatever was there will be moved to the last index -- Type 42
          *  fonts are considered invalid under this condition.
+         *
+         *  If a CoverageFilter is attached to the face, codes which it
+         *  rejects return 0 without calling FreeType.
          */
         UInt get_char_index( ULong charcode );
 
@@ -468,6 +496,9 @@ struct Face
     typedef FT_Face         cobjptr;
 };
 
+template <> void RefPtr<Face>::reference();
+template <> void RefPtr<Face>::dereference();
+
 
 
 
@@ -0,0 +1,168 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/FallbackChain.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_FALLBACKCHAIN_H_
+#define CPPFREETYPE_FALLBACKCHAIN_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/Coverage.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// a stretch of text which FallbackChain resolves to a single face
+struct FallbackRun
+{
+    UInt    face;       ///< index of the face in the chain
+    size_t  begin;      ///< byte offset of the first character
+    size_t  end;        ///< byte offset one past the last character
+};
+
+/// resolves code points against an ordered list of faces
+/**
+ *  Rather than asking each face in turn for a glyph, which costs a cmap
+ *  search per face for every character the primary face lacks, the chain
+ *  merges the charmaps of its faces once into a page table like the one of
+ *  CharmapIndex. Each entry packs the index of the first face which maps
+ *  the code, in the high 8 bits, with that face's glyph index, in the low
+ *  24 bits, so resolving a code point is two loads whatever the number of
+ *  faces. Codes which no face maps resolve to glyph 0 of face 0.
+ *
+ *  The chain holds a reference to each of its faces, clear() it before
+ *  the library is done. Like CharmapIndex it is a snapshot of the active
+ *  charmaps when each face was added.
+ */
+class FallbackChain
+{
+    public:
+        /// one past the largest resolved code point
+        static const UInt32 LIMIT       = 0x110000;
+
+        static const UInt32 PAGE_BITS   = 8;
+        static const UInt32 PAGE_SIZE   = 1 << PAGE_BITS;
+        static const UInt32 NUM_PAGES   = LIMIT >> PAGE_BITS;
+
+        /// bits of an entry holding the glyph index
+        static const UInt32 GLYPH_BITS  = 24;
+        static const UInt32 GLYPH_MASK  = ( 1 << GLYPH_BITS ) - 1;
+
+        /// most faces a chain can hold
+        static const UInt32 MAX_FACES   = 1 << ( 32 - GLYPH_BITS );
+
+    private:
+        std::vector< RefPtr<Face> > m_faces;
+        std::vector< Coverage >     m_coverage; ///< of each face
+        UInt32                      m_top[NUM_PAGES];   ///< page offsets
+                                                        ///  into m_entries
+        std::vector<UInt32>         m_entries;  ///< pages of packed entries,
+                                                ///  the first is empty
+        size_t                      m_size;     ///< number of mapped codes
+
+        /// not copy-constructable
+        FallbackChain( const FallbackChain& );
+
+        /// not copy-assignable
+        FallbackChain& operator=( const FallbackChain& );
+
+    public:
+        /// an empty chain, every code resolves to glyph 0
+        FallbackChain();
+
+        /// append @p face at the lowest priority
+        /**
+         *  Codes which faces already in the chain map are left to them,
+         *  the others which @p face maps now resolve to it.
+         *
+         *  @return 0, or FT_Err_Invalid_Argument if @p face is NULL or the
+         *          chain already holds MAX_FACES faces
+         */
+        Error add( RefPtr<Face>& face );
+
+        /// drop every face and mapping
+        void clear();
+
+        /// the packed entry of @p char_code, 0 if no face maps it
+        UInt32 lookup( ULong char_code ) const
+        {
+            if( char_code >= LIMIT )
+                return 0;
+            return m_entries[ m_top[ char_code >> PAGE_BITS ]
+                              + ( char_code & (PAGE_SIZE-1) ) ];
+        }
+
+        /// the face index of a packed entry
+        static UInt face_of( UInt32 entry )
+        {
+            return entry >> GLYPH_BITS;
+        }
+
+        /// the glyph index of a packed entry
+        static UInt glyph_of( UInt32 entry )
+        {
+            return entry & GLYPH_MASK;
+        }
+
+        /// the face and glyph index of @p char_code
+        /**
+         *  @return whether any face maps @p char_code, if not @p face and
+         *          @p glyph are set to 0
+         */
+        bool resolve( ULong char_code, UInt& face, UInt& glyph ) const;
+
+        /// split UTF-8 text into runs which each use a single face
+        /**
+         *  Each character goes to the face it resolves to, except that
+         *  combining marks, joiners, variation selectors and spaces stay
+         *  in the current run when its face maps them, and characters
+         *  which no face maps join the current run, so a run of a fallback
+         *  face is not broken around them. The runs are appended to
+         *  @p runs and cover the text without gaps.
+         */
+        void segment( const char* utf8, size_t length,
+                      std::vector<FallbackRun>& runs ) const;
+
+        /// number of faces
+        size_t num_faces() const;
+
+        /// face @p i
+        RefPtr<Face>& face( size_t i );
+
+        /// number of codes which some face maps
+        size_t size() const;
+
+        /// number of non-empty pages
+        size_t num_pages() const;
+
+        /// bytes of memory used by the chain
+        size_t bytes() const;
+};
+
+} // namespace freetype
+
+#endif // FALLBACKCHAIN_H_
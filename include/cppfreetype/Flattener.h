@@ -0,0 +1,232 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/Flattener.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_FLATTENER_H_
+#define CPPFREETYPE_FLATTENER_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/AssignmentPair.h>
+#include <cppfreetype/Outline.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/GlyphCache.h>
+#include <cppfreetype/LruCache.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// an outline flattened to closed polylines
+/**
+ *  Contours are implicitly closed, the last point of a contour is not a
+ *  repeat of its first point.
+ */
+struct FlattenedOutline
+{
+    std::vector<float>  xy;             ///< interleaved x,y of every point
+    std::vector<UInt>   contour_ends;   ///< one past the last point of each
+                                        ///  contour
+
+    /// drop all points, keeping the storage
+    void clear();
+
+    UInt n_points() const;
+    UInt n_contours() const;
+
+    /// number of bytes of heap memory held
+    size_t bytes() const;
+};
+
+/// adaptive flattening of outlines into polylines
+/**
+ *  Each conic or cubic segment is split into the smallest number of
+ *  uniform steps which keeps the polyline within the tolerance of the
+ *  curve (by Wang's bound on the second differences of the control
+ *  points). The points of a segment are evaluated in batches with SSE2 or
+ *  AVX2 when the compiler targets them, and one at a time otherwise.
+ *
+ *  Coordinates are multiplied by the scale on output, so the default scale
+ *  of 1/64 turns the 26.6 coordinates of a scaled outline into pixels. The
+ *  tolerance is in output units.
+ *
+ *  A Flattener is the visitor passed to decompose(), so its path members
+ *  are public, but it is meant to be used through flatten().
+ */
+class Flattener
+{
+    public:
+        /// upper bound on the number of steps a single curve is split into
+        static const UInt MAX_SEGMENTS = 128;
+
+    private:
+        float               m_tolerance;
+        float               m_scale;
+        FlattenedOutline*   m_out;
+        float               m_x;        ///< current point, scaled
+        float               m_y;
+        UInt                m_start;    ///< first point of the contour
+
+        /// close the current contour, if any
+        void finish_contour();
+
+        /// append the @p n points of a curve given by the polynomial
+        /// coefficients @p cx and @p cy
+        void emit( const float cx[4], const float cy[4], UInt n,
+                   float end_x, float end_y );
+
+    public:
+        explicit Flattener( float tolerance = 0.25f, float scale = 1/64.0f );
+
+        float tolerance() const;
+        void  set_tolerance( float tolerance );
+        float scale() const;
+        void  set_scale( float scale );
+
+        /// flatten @p outline into @p out, replacing its contents
+        Error flatten( const OutlineView& outline, FlattenedOutline& out );
+
+        /// flatten @p outline into @p out, replacing its contents
+        Error flatten( RefPtr<Outline> outline, FlattenedOutline& out );
+
+        /// decompose() visitor interface
+        Error move_to ( const FT_Vector& to );
+        Error line_to ( const FT_Vector& to );
+        Error conic_to( const FT_Vector& control, const FT_Vector& to );
+        Error cubic_to( const FT_Vector& control1, const FT_Vector& control2,
+                        const FT_Vector& to );
+
+        /// number of steps needed to keep a curve of @p degree (2 or 3)
+        /// whose largest second difference has length @p dd within
+        /// @p tolerance
+        static UInt segments( UInt degree, float dd, float tolerance );
+
+        /// evaluate the cubic polynomial ((d*t + c)*t + b)*t + a at
+        /// t = k/n for k = 1..n, writing interleaved points to @p xy
+        /**
+         *  @param[in]  cx      a, b, c, d for the x coordinate
+         *  @param[in]  cy      a, b, c, d for the y coordinate
+         *  @param[in]  n       number of points
+         *  @param[out] xy      2*n floats
+         */
+        static void evaluate( const float cx[4], const float cy[4], UInt n,
+                              float* xy );
+};
+
+/// key of a flattened glyph, the glyph at the face's active size plus the
+/// flattening parameters
+struct FlattenKey
+{
+    GlyphKey    glyph;      ///< render_mode is unused and always NORMAL
+    float       tolerance;
+    float       scale;
+
+    FlattenKey();
+
+    static FlattenKey make( RefPtr<Face>& face,
+                            UInt          glyph_index,
+                            Int32         load_flags,
+                            float         tolerance,
+                            float         scale );
+
+    bool operator==( const FlattenKey& other ) const;
+};
+
+/// hash functor for FlattenKey
+struct FlattenKeyHash
+{
+    size_t operator()( const FlattenKey& key ) const;
+};
+
+/// least-recently-used cache of flattened glyph outlines
+/**
+ *  Works like GlyphCache, with the same caveats: entries are keyed by the
+ *  FT_Face pointer so purge() a face before it goes away, returned pointers
+ *  are valid until the next call which may insert or evict, and the cache
+ *  is not thread safe.
+ */
+class FlattenCache :
+    private LruCache< FlattenKey, FlattenedOutline, FlattenKeyHash >
+{
+    private:
+        typedef LruCache< FlattenKey, FlattenedOutline, FlattenKeyHash >
+                Lru_t;
+
+        Flattener   m_flattener;
+
+        /// not copy-constructable
+        FlattenCache( const FlattenCache& );
+
+        /// not copy-assignable
+        FlattenCache& operator=( const FlattenCache& );
+
+    public:
+        /// hit / miss counters, misses are lookups which flattened the
+        /// glyph
+        typedef Lru_t::Stats Stats;
+
+        /// create a cache which holds at most @p budget bytes
+        explicit FlattenCache( size_t budget = 4*1024*1024 );
+
+        /// return the flattened glyph, loading and flattening it on a miss
+        /**
+         *  @param[in]  face        face to load the glyph from, at its
+         *                          currently active size
+         *  @param[in]  glyph_index index of the glyph within the face
+         *  @param[in]  load_flags  flags passed to load_glyph
+         *  @param[in]  tolerance   see Flattener
+         *  @param[in]  scale       see Flattener
+         *  @return the cached outline, or NULL if loading failed or the
+         *          glyph is not an outline
+         */
+        const FlattenedOutline* lookup( RefPtr<Face>& face,
+                                        UInt          glyph_index,
+                                        Int32         load_flags,
+                                        float         tolerance = 0.25f,
+                                        float         scale = 1/64.0f );
+
+        /// same as lookup() but also returns the FreeType error code
+        RValuePair< const FlattenedOutline*, Error > lookup_e(
+                                        RefPtr<Face>& face,
+                                        UInt          glyph_index,
+                                        Int32         load_flags,
+                                        float         tolerance = 0.25f,
+                                        float         scale = 1/64.0f );
+
+        /// drop every outline which was loaded from @p face
+        void purge( RefPtr<Face>& face );
+
+        using Lru_t::clear;
+        using Lru_t::set_budget;
+        using Lru_t::budget;
+        using Lru_t::bytes;
+        using Lru_t::size;
+        using Lru_t::stats;
+        using Lru_t::reset_stats;
+};
+
+} // namespace freetype
+
+#endif // FLATTENER_H_
@@ -0,0 +1,169 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/FontIndex.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_FONTINDEX_H_
+#define CPPFREETYPE_FONTINDEX_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/Coverage.h>
+
+#include <string>
+#include <vector>
+
+namespace freetype {
+
+/// what a FontIndex knows about one face of one font file
+struct FontEntry
+{
+    std::string         filepath;
+    Long                face_index;
+    Long                num_faces;      ///< faces in the file
+    std::string         family_name;    ///< empty if the face has none
+    std::string         style_name;     ///< empty if the face has none
+    Long                style_flags;
+    Long                face_flags;
+    Long                num_glyphs;
+    unsigned long long  file_size;      ///< bytes, when indexed
+    long long           mtime_sec;      ///< modification time, when
+    long long           mtime_nsec;     ///  indexed
+    Coverage            coverage;       ///< codes of the Unicode charmap
+
+    FontEntry();
+};
+
+/// metadata and coverage of every face in a set of font directories
+/**
+ *  scan() walks the directories for font files and opens each one with a
+ *  Library per worker thread, once per face including every face of a
+ *  collection, to record its names, flags and Unicode coverage. Files
+ *  whose size and modification time match the entries already held are
+ *  not opened again, so
+ *
+ *  @code
+ *  index.load( cache_path );
+ *  index.scan( directories );
+ *  index.save( cache_path );
+ *  @endcode
+ *
+ *  opens no font at all when nothing changed.
+ *
+ *  Entries are sorted by file path and face index.
+ */
+class FontIndex
+{
+    public:
+        static const UInt32 VERSION = 1;    ///< index file format version
+
+    private:
+        std::vector<FontEntry>  m_faces;
+        std::vector<FontEntry>  m_rejected; ///< files FreeType does not
+                                            ///  recognize, no faces
+        size_t                  m_opened;   ///< files opened by last scan
+
+        /// not copy-constructable
+        FontIndex( const FontIndex& );
+
+        /// not copy-assignable
+        FontIndex& operator=( const FontIndex& );
+
+    public:
+        FontIndex();
+
+        /// index the font files found in @p directories and their
+        /// subdirectories, replacing the entries
+        /**
+         *  @param[in]  directories     directories to walk
+         *  @param[in]  threads         number of workers, 0 for one per
+         *                              hardware thread
+         *
+         *  @return 0, or the first error met opening a directory. Files
+         *          which FreeType can not open are skipped.
+         */
+        Error scan( const std::vector<std::string>& directories,
+                    UInt threads = 0 );
+
+        /// take the entries of @p previous, re-indexing only what lies
+        /// at or below @p paths
+        /**
+         *  Each path may be a font file or a directory which was added,
+         *  changed or removed. Entries outside of the paths are copied
+         *  from @p previous without looking at the disk, files below them
+         *  are opened only if their size or modification time changed.
+         *
+         *  @param[in]  previous    the index to start from, may not be
+         *                          this one
+         *  @param[in]  paths       changed files and directories
+         *  @param[in]  threads     see scan()
+         *
+         *  @return 0, or the first error met opening a directory, paths
+         *          which no longer exist are not an error
+         */
+        Error update( const FontIndex& previous,
+                      const std::vector<std::string>& paths,
+                      UInt threads = 0 );
+
+        /// read an index written by save(), replacing the entries
+        /**
+         *  @return 0, an error opening the file, FT_Err_Unknown_File_Format
+         *          if it is not an index or is truncated, or
+         *          FT_Err_Invalid_Version if it has another format version
+         */
+        Error load( const char* filepath );
+
+        /// write the entries to @p filepath
+        Error save( const char* filepath ) const;
+
+        /// number of faces
+        size_t size() const;
+
+        /// face @p i
+        const FontEntry& operator[]( size_t i ) const;
+
+        /// the entry of face @p face_index of @p filepath, or NULL
+        const FontEntry* find( const char* filepath,
+                               Long face_index = 0 ) const;
+
+        /// append the index of every face of family @p family_name
+        void find_family( const char* family_name,
+                          std::vector<size_t>& out ) const;
+
+        /// append the index of every face which maps @p charcode
+        void find_coverage( ULong charcode, std::vector<size_t>& out ) const;
+
+        /// number of font files opened by the last scan(), files which
+        /// FreeType does not recognize as fonts are remembered and only
+        /// retried once they change, files which failed for other reasons
+        /// (e.g. out of memory or file descriptors) are retried by the
+        /// next scan
+        size_t files_opened() const;
+
+        /// drop every entry
+        void clear();
+};
+
+} // namespace freetype
+
+#endif // FONTINDEX_H_
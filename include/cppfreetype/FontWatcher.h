@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/FontWatcher.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_FONTWATCHER_H_
+#define CPPFREETYPE_FONTWATCHER_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/FontIndex.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace freetype {
+
+/// keeps a FontIndex of some directories current in the background
+/**
+ *  Readers take the current index with snapshot(), an immutable FontIndex
+ *  which stays valid for as long as they hold it. A new snapshot is built
+ *  beside the current one and published with an atomic swap, so readers
+ *  never wait for a scan.
+ *
+ *  On Linux start() also watches the directories and their subdirectories
+ *  with inotify. A background thread collects changed paths until the
+ *  directories have been quiet for a short while, then builds the next
+ *  snapshot with FontIndex::update(), which opens only the fonts which
+ *  changed. Elsewhere, and whenever inotify is unavailable, call refresh()
+ *  to rescan.
+ *
+ *  If an index file is given the index is loaded from it at start, so an
+ *  unchanged directory opens no font, and saved after every update.
+ */
+class FontWatcher
+{
+    public:
+        typedef std::shared_ptr<const FontIndex> Snapshot_t;
+
+    private:
+        typedef std::map< int, std::string > Watches_t;
+
+        std::vector<std::string>    m_directories;
+        std::string                 m_index_path;
+        UInt                        m_threads;
+        Snapshot_t                  m_snapshot;     ///< only accessed with
+                                                    ///  atomic_load/store
+        std::atomic<ULong>          m_generation;
+        std::mutex                  m_update;       ///< serializes updates
+
+        std::thread                 m_thread;
+        std::atomic<bool>           m_stop;
+        int                         m_inotify;      ///< -1 if not watching
+        int                         m_wake[2];      ///< pipe to stop
+        Watches_t                   m_watches;      ///< descriptor to path
+
+        /// not copy-constructable
+        FontWatcher( const FontWatcher& );
+
+        /// not copy-assignable
+        FontWatcher& operator=( const FontWatcher& );
+
+        /// publish @p index as the current snapshot
+        void publish( FontIndex* index );
+
+        /// build and publish the next snapshot from the changed @p paths,
+        /// or from a full scan if @p paths is empty
+        Error update( const std::vector<std::string>& paths );
+
+        /// watch @p directory and its subdirectories
+        void watch( const std::string& directory );
+
+        /// @p directory was moved into a watched directory, rename the
+        /// watches it already had and watch it if it had none
+        void moved( const std::string& directory );
+
+        /// the background thread
+        void run();
+
+    public:
+        /// a watcher of @p directories, see FontIndex::scan() for
+        /// @p threads
+        explicit FontWatcher( const std::vector<std::string>& directories,
+                              UInt threads = 0 );
+
+        /// stops the background thread
+        ~FontWatcher();
+
+        /// build the first snapshot and start watching
+        /**
+         *  @param[in]  index_path  index file to start from and to save
+         *                          updates to, or NULL
+         *
+         *  @return the error of the first scan, the snapshot is published
+         *          in any case
+         */
+        Error start( const char* index_path = 0 );
+
+        /// stop watching, the current snapshot stays available
+        void stop();
+
+        /// rescan every directory now and publish the result
+        Error refresh();
+
+        /// the current index, never NULL once start() returned
+        Snapshot_t snapshot() const;
+
+        /// number of snapshots published so far
+        ULong generation() const;
+
+        /// whether changes are picked up in the background
+        bool watching() const;
+};
+
+} // namespace freetype
+
+#endif // FONTWATCHER_H_
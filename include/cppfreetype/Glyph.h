@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/Glyph.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_GLYPH_H_
+#define CPPFREETYPE_GLYPH_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_GLYPH_H
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Library.h>
+#include <cppfreetype/GlyphSlot.h>
+#include <cppfreetype/Outline.h>
+#include <cppfreetype/BitmapView.h>
+
+namespace freetype {
+
+/// an owned glyph image, outline or bitmap, which outlives the glyph slot
+/// it was taken from
+/**
+ *  The glyph slot of a face is overwritten by the next load, a Glyph keeps
+ *  a copy made with FT_Get_Glyph and frees it with FT_Done_Glyph when it
+ *  is destroyed. Copying a Glyph copies the image with FT_Glyph_Copy.
+ *
+ *  FreeType allocates the image through the memory manager of the slot's
+ *  library, and a Glyph holds a reference to that library so it stays
+ *  valid. Glyphs of the faces of a LibraryPool therefore come from the
+ *  slab allocator of the calling thread's library, and churning through
+ *  them does not fragment the heap. Like the pool's faces, such glyphs
+ *  must only be used, copied and destroyed on the thread which made them.
+ */
+class Glyph
+{
+    private:
+        RefPtr<Library> m_library;
+        FT_Glyph        m_glyph;    ///< NULL if empty
+
+    public:
+        /// an empty glyph
+        Glyph();
+
+        /// a copy of @p other, empty if @p other is or the copy fails
+        Glyph( const Glyph& other );
+
+        /// frees the image
+        ~Glyph();
+
+        /// replace the image with a copy of the one of @p other
+        Glyph& operator=( const Glyph& other );
+
+        /// replace the image with a copy of the one loaded in @p slot
+        Error get( RefPtr<GlyphSlot> slot );
+
+        /// replace the image with a copy of the one of @p other
+        Error copy( const Glyph& other );
+
+        /// free the image, leaving the glyph empty
+        void release();
+
+        /// whether the glyph holds an image
+        bool is_valid() const;
+
+        /// format of the image
+        GlyphFormat format() const;
+
+        /// advance in 16.16 pixels
+        const FT_Vector& advance() const;
+
+        /// transform the outline and advance of an outline glyph
+        /**
+         *  @param[in]  matrix  2x2 matrix to apply, or NULL
+         *  @param[in]  delta   translation in 26.6 pixels, or NULL
+         *
+         *  @return FT_Err_Invalid_Glyph_Format for a bitmap glyph
+         */
+        Error transform( const FT_Matrix* matrix, const FT_Vector* delta );
+
+        /// control box of the image
+        /**
+         *  @param[in]  bbox_mode   an FT_Glyph_BBox_Mode, FT_GLYPH_BBOX_PIXELS
+         *                          gives grid fitted integer pixels
+         */
+        FT_BBox cbox( UInt bbox_mode = FT_GLYPH_BBOX_PIXELS ) const;
+
+        /// render an outline glyph, replacing it by a bitmap glyph
+        /**
+         *  @param[in]  mode    how to render
+         *  @param[in]  origin  translation in 26.6 pixels applied before
+         *                      rendering, or NULL
+         *
+         *  @return 0, doing nothing, if the glyph is already a bitmap
+         */
+        Error to_bitmap( render_mode::RenderMode mode,
+                         const FT_Vector* origin = 0 );
+
+        /// the outline of an outline glyph, NULL otherwise
+        RefPtr<Outline> outline();
+
+        /// the bitmap of a bitmap glyph, an empty view otherwise
+        BitmapView bitmap() const;
+
+        /// distance from the pen to the left edge of the bitmap, in pixels
+        Int bitmap_left() const;
+
+        /// distance from the baseline up to the top row of the bitmap, in
+        /// pixels
+        Int bitmap_top() const;
+
+        /// the underlying FT_Glyph, subverting ownership
+        FT_Glyph subvert();
+};
+
+} // namespace freetype
+
+#endif // GLYPH_H_
@@ -0,0 +1,232 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/GlyphAtlas.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_GLYPHATLAS_H_
+#define CPPFREETYPE_GLYPHATLAS_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/GlyphSlot.h>
+#include <cppfreetype/GlyphCache.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// a rectangle of pixels within an atlas page
+struct AtlasRect
+{
+    Int x;          ///< left edge
+    Int y;          ///< top edge
+    Int width;      ///< width in pixels
+    Int height;     ///< height in pixels
+
+    AtlasRect( Int x=0, Int y=0, Int width=0, Int height=0 );
+
+    /// true if the rectangle covers no pixels
+    bool empty() const;
+
+    /// grow this rectangle so that it also covers @p other
+    void merge( const AtlasRect& other );
+};
+
+/// where a glyph ended up in the atlas, and how to place it
+struct AtlasGlyph
+{
+    UInt        page;       ///< index of the page holding the glyph
+    AtlasRect   rect;       ///< pixel rectangle within the page
+    float       u0;         ///< left texture coordinate
+    float       v0;         ///< top texture coordinate
+    float       u1;         ///< right texture coordinate
+    float       v1;         ///< bottom texture coordinate
+    Int         bearing_x;  ///< bitmap_left of the glyph, in pixels
+    Int         bearing_y;  ///< bitmap_top of the glyph, in pixels
+    FT_Vector   advance;    ///< 26.6 advance of the glyph
+
+    AtlasGlyph();
+};
+
+/// one fixed-size 8-bit page of an atlas, packed with a skyline allocator
+class AtlasPage
+{
+    private:
+        /// a horizontal segment of the skyline
+        struct Node
+        {
+            Int x;
+            Int y;
+            Int width;
+        };
+
+        Int                 m_width;
+        Int                 m_height;
+        std::vector<Byte>   m_pixels;   ///< m_width*m_height coverage values
+        std::vector<Node>   m_skyline;  ///< left to right, covers the width
+        AtlasRect           m_dirty;    ///< region changed since last upload
+        ULong               m_used;     ///< number of pixels allocated
+
+        /// lowest y at which a @p width wide rectangle fits starting at node
+        /// @p i, or -1 if it does not fit
+        Int fit( size_t i, Int width, Int height ) const;
+
+    public:
+        AtlasPage( Int width, Int height );
+
+        /// reserve a @p width x @p height rectangle using the bottom-left
+        /// skyline heuristic
+        /**
+         *  @return false if the rectangle does not fit on this page
+         */
+        bool allocate( Int width, Int height, AtlasRect& out );
+
+        /// copy a bitmap into the page at @p rect, converting it to 8-bit
+        /// coverage values, and mark the region dirty
+        /**
+         *  @param[in]  buffer      first byte of the bitmap, as stored in
+         *                          FT_Bitmap::buffer
+         *  @param[in]  pitch       FT_Bitmap::pitch, may be negative
+         *  @param[in]  pixel_mode  pixelmode::PixelMode of the bitmap
+         *  @param[in]  num_grays   FT_Bitmap::num_grays, gray levels of a
+         *                          GRAY bitmap
+         *  @param[in]  rect        destination, its size is the size of the
+         *                          bitmap in bytes (LCD) or pixels (others)
+         */
+        void blit( const Byte* buffer, Int pitch, Byte pixel_mode,
+                   UShort num_grays, const AtlasRect& rect );
+
+        Int         width()  const;
+        Int         height() const;
+
+        /// the page's pixels, row major with a pitch of width()
+        const Byte* pixels() const;
+
+        /// number of pixels allocated to glyphs, including padding
+        ULong       used() const;
+
+        /// return the region modified since the last call, and reset it
+        /**
+         *  @return false if nothing changed
+         */
+        bool take_dirty( AtlasRect& rect );
+
+        /// forget all glyphs and clear the pixels
+        void clear();
+};
+
+/// packs rendered glyph bitmaps into one or more fixed-size 8-bit pages
+/**
+ *  Glyphs are packed with a skyline bottom-left allocator. Each page
+ *  remembers the bounding rectangle of the pixels written since the last
+ *  call to take_dirty(), so that only that region needs to be uploaded.
+ *
+ *  Bitmaps in MONO, GRAY2 and GRAY4 mode are expanded to 8-bit coverage.
+ *  LCD and LCD_V bitmaps are copied byte-for-byte, so an LCD glyph occupies
+ *  three atlas pixels per glyph pixel.
+ */
+class GlyphAtlas
+{
+    private:
+        Int                     m_page_width;
+        Int                     m_page_height;
+        Int                     m_padding;      ///< empty pixels around glyphs
+        UInt                    m_max_pages;    ///< 0 means unlimited
+        std::vector<AtlasPage>  m_pages;
+
+        /// not copy-constructable
+        GlyphAtlas( const GlyphAtlas& );
+
+        /// not copy-assignable
+        GlyphAtlas& operator=( const GlyphAtlas& );
+
+    public:
+        /// create an atlas of @p page_width x @p page_height pages
+        /**
+         *  @param[in]  page_width  width of each page in pixels
+         *  @param[in]  page_height height of each page in pixels
+         *  @param[in]  padding     number of empty pixels kept between
+         *                          glyphs, to avoid bleeding when sampling
+         *  @param[in]  max_pages   maximum number of pages, 0 for no limit
+         */
+        GlyphAtlas( Int  page_width  = 1024,
+                    Int  page_height = 1024,
+                    Int  padding     = 1,
+                    UInt max_pages   = 0 );
+
+        /// pack a raw bitmap
+        /**
+         *  The arguments are the fields of an FT_Bitmap, GRAY bitmaps with
+         *  other than 256 gray levels are scaled to 0-255.
+         *
+         *  @return false if the bitmap is larger than a page or all pages
+         *          are full and the page limit has been reached
+         */
+        bool insert( const Byte* buffer,
+                     Int         width,
+                     Int         rows,
+                     Int         pitch,
+                     Byte        pixel_mode,
+                     UShort      num_grays,
+                     AtlasGlyph& out );
+
+        /// pack the bitmap currently held by a rendered glyph slot
+        bool insert( RefPtr<GlyphSlot> slot, AtlasGlyph& out );
+
+        /// pack a glyph previously copied into a GlyphCache
+        bool insert( const CachedGlyph& glyph, AtlasGlyph& out );
+
+        /// load a glyph with load_glyph, render it if needed, and pack it
+        /**
+         *  @return FreeType error code. 0 means success. If the glyph could
+         *          not be packed FT_Err_Out_Of_Memory is returned.
+         */
+        Error add( RefPtr<Face>& face,
+                   UInt          glyph_index,
+                   Int32         load_flags,
+                   AtlasGlyph&   out,
+                   render_mode::RenderMode mode = render_mode::NORMAL );
+
+        Int         page_width()  const;
+        Int         page_height() const;
+        UInt        num_pages()   const;
+
+        /// access a page, e.g. for uploading
+        AtlasPage&       page( UInt i );
+        const AtlasPage& page( UInt i ) const;
+
+        /// fraction of the allocated pages' area which is covered by glyphs
+        float efficiency() const;
+
+        /// drop all pages
+        void clear();
+};
+
+} // namespace freetype
+
+#endif // GLYPHATLAS_H_
@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/GlyphBatch.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_GLYPHBATCH_H_
+#define CPPFREETYPE_GLYPHBATCH_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/Outline.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// one distinct glyph of a GlyphBatch
+/**
+ *  The image of the glyph lives in the batch's shared buffers, at the
+ *  offsets given here. A glyph has a bitmap or an outline depending on the
+ *  format it was loaded in.
+ */
+struct BatchGlyph
+{
+    UInt                glyph_index;
+    Error               error;          ///< error from loading this glyph
+    FT_Glyph_Format     format;         ///< format of the loaded image
+    FT_Glyph_Metrics    metrics;
+    FT_Vector           advance;        ///< 26.6 transformed advance
+    Pos                 lsb_delta;      ///< left side bearing hint delta
+    Pos                 rsb_delta;      ///< right side bearing hint delta
+
+    Int                 bitmap_left;    ///< left bearing in pixels
+    Int                 bitmap_top;     ///< top bearing in pixels
+    Int                 width;          ///< bitmap width in pixels
+    Int                 rows;           ///< bitmap height in pixels
+    Int                 pitch;          ///< bytes per row, always >= 0
+    Byte                pixel_mode;     ///< pixelmode::PixelMode
+    UShort              num_grays;      ///< number of gray levels
+    size_t              bitmap_offset;  ///< first byte in pixels
+
+    UInt                first_point;    ///< first point in points / tags
+    Int                 n_points;
+    UInt                first_contour;  ///< first entry in contours
+    Int                 n_contours;
+    Int                 outline_flags;  ///< FT_OUTLINE_XXX
+
+    BatchGlyph();
+};
+
+/// caller owned destination of FaceDelegate::load_glyphs
+/**
+ *  A batch keeps the metrics of every distinct glyph in one array and
+ *  their bitmaps and outlines in shared contiguous buffers, so loading a
+ *  run of glyphs allocates nothing once the batch has grown to the size of
+ *  the runs it is used for. Repeated glyphs are spotted with a table
+ *  indexed by glyph, sized to the face once and reused by every load.
+ *  Reuse one batch for many runs.
+ *
+ *  Bitmaps are stored top-down, the same as CachedGlyph. Outline contour
+ *  indices are relative to the glyph's first point, so outline() returns a
+ *  view which works with decompose() and CompactOutline.
+ */
+struct GlyphBatch
+{
+    std::vector<BatchGlyph> glyphs;     ///< one entry per distinct glyph
+    std::vector<UInt>       order;      ///< for each requested index, its
+                                        ///  entry in glyphs
+    std::vector<Byte>       pixels;     ///< all bitmaps
+    std::vector<FT_Vector>  points;     ///< all outline points
+    std::vector<char>       tags;       ///< all outline tags
+    std::vector<Short>      contours;   ///< all outline contour ends
+    ULong                   duplicates; ///< requests served by an earlier
+                                        ///  load in the same batch
+
+    GlyphBatch();
+
+    /// drop all glyphs, keeping the storage
+    void clear();
+
+    /// load @p count glyphs of @p face into the batch, replacing its
+    /// contents, see FaceDelegate::load_glyphs
+    Error load( FT_Face       face,
+                const UInt*   glyph_indices,
+                size_t        count,
+                Int32         load_flags );
+
+    /// number of glyphs requested
+    size_t size() const;
+
+    /// the glyph loaded for the @p i'th requested index
+    const BatchGlyph& operator[]( size_t i ) const;
+
+    /// first byte of the bitmap of @p glyph
+    const Byte* bitmap( const BatchGlyph& glyph ) const;
+
+    /// the outline of @p glyph
+    OutlineView outline( const BatchGlyph& glyph ) const;
+
+    private:
+        /// for each glyph index, the load which last saw it and its entry
+        /// in glyphs, a glyph was seen by this load if its stamp is
+        /// m_generation
+        struct Seen
+        {
+            UInt    stamp;
+            UInt    entry;
+        };
+
+        std::vector<Seen>   m_seen;
+        UInt                m_generation;
+
+        /// copy the image in @p slot to the end of the buffers
+        void append( FT_GlyphSlot slot, BatchGlyph& glyph );
+};
+
+} // namespace freetype
+
+#endif // GLYPHBATCH_H_
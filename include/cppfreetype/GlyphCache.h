@@ -0,0 +1,190 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/GlyphCache.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_GLYPHCACHE_H_
+#define CPPFREETYPE_GLYPHCACHE_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/GlyphSlot.h>
+#include <cppfreetype/LruCache.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// identifies one rendered glyph image: the face, the size it was rendered
+/// at, the glyph, and how it was loaded and rendered
+struct GlyphKey
+{
+    FT_Face     face;           ///< face the glyph was loaded from
+    UShort      x_ppem;         ///< horizontal pixels per EM
+    UShort      y_ppem;         ///< vertical pixels per EM
+    Fixed       x_scale;        ///< 16.16 font-unit to 26.6 scale
+    Fixed       y_scale;        ///< 16.16 font-unit to 26.6 scale
+    UInt        glyph_index;    ///< index of the glyph within the face
+    Int32       load_flags;     ///< flags passed to load_glyph
+    Int         render_mode;    ///< render_mode::RenderMode used
+
+    GlyphKey();
+
+    /// build a key for the face's currently active size
+    static GlyphKey make( RefPtr<Face>& face,
+                          UInt          glyph_index,
+                          Int32         load_flags,
+                          render_mode::RenderMode mode );
+
+    bool operator==( const GlyphKey& other ) const;
+};
+
+/// hash functor for GlyphKey
+struct GlyphKeyHash
+{
+    size_t operator()( const GlyphKey& key ) const;
+};
+
+/// an owned copy of a rendered glyph image and its metrics
+/**
+ *  The bitmap is always stored top-down, i.e. the copied pitch is positive
+ *  and equal to the number of bytes in one row, regardless of the flow of
+ *  the bitmap in the glyph slot it was copied from.
+ */
+struct CachedGlyph
+{
+    Int                 width;          ///< bitmap width in pixels
+    Int                 rows;           ///< bitmap height in pixels
+    Int                 pitch;          ///< bytes per row, always >= 0
+    Byte                pixel_mode;     ///< pixelmode::PixelMode
+    UShort              num_grays;      ///< number of gray levels
+    Int                 bitmap_left;    ///< left bearing in pixels
+    Int                 bitmap_top;     ///< top bearing in pixels
+    FT_Vector           advance;        ///< 26.6 transformed advance
+    FT_Glyph_Metrics    metrics;        ///< metrics of the loaded glyph
+    Pos                 lsb_delta;      ///< left side bearing hint delta
+    Pos                 rsb_delta;      ///< right side bearing hint delta
+    std::vector<Byte>   buffer;         ///< rows*pitch bytes of pixels
+
+    CachedGlyph();
+
+    /// copy the bitmap and metrics out of a glyph slot, the slot should
+    /// already have been rendered
+    void assign( RefPtr<GlyphSlot> slot );
+
+    /// number of bytes of heap memory held by this glyph
+    size_t bytes() const;
+};
+
+/// least-recently-used cache of rendered glyph bitmaps
+/**
+ *  Every face has a single glyph slot so FreeType re-hints and re-rasterizes
+ *  a glyph each time it is loaded. The cache keeps owned copies of rendered
+ *  bitmaps keyed by GlyphKey, so a repeated glyph costs a hash lookup. When
+ *  the memory held by the cache exceeds the configured budget the least
+ *  recently used glyphs are evicted.
+ *
+ *  @note   entries are keyed by the underlying FT_Face pointer, so call
+ *          purge() before the last reference to a face goes away
+ *  @note   pointers returned by lookup() and find() remain valid only until
+ *          the next call which may insert into or evict from the cache
+ *  @note   the cache is not thread safe
+ */
+class GlyphCache :
+    private LruCache< GlyphKey, CachedGlyph, GlyphKeyHash >
+{
+    private:
+        typedef LruCache< GlyphKey, CachedGlyph, GlyphKeyHash > Lru_t;
+
+        /// not copy-constructable
+        GlyphCache( const GlyphCache& );
+
+        /// not copy-assignable
+        GlyphCache& operator=( const GlyphCache& );
+
+    public:
+        /// hit / miss counters, misses are lookups which loaded the glyph
+        typedef Lru_t::Stats Stats;
+
+        /// create a cache which holds at most @p budget bytes
+        explicit GlyphCache( size_t budget = 4*1024*1024 );
+
+        /// return the rendered glyph, loading and rendering it on a miss
+        /**
+         *  @param[in]  face        face to load the glyph from, at its
+         *                          currently active size
+         *  @param[in]  glyph_index index of the glyph within the face
+         *  @param[in]  load_flags  flags passed to load_glyph
+         *  @param[in]  mode        render mode used if the loaded glyph is
+         *                          not already a bitmap
+         *  @return the cached glyph, or NULL if loading or rendering failed
+         */
+        const CachedGlyph* lookup( RefPtr<Face>& face,
+                                   UInt          glyph_index,
+                                   Int32         load_flags,
+                                   render_mode::RenderMode mode
+                                                = render_mode::NORMAL );
+
+        /// same as lookup() but also returns the FreeType error code
+        RValuePair< const CachedGlyph*, Error > lookup_e(
+                                   RefPtr<Face>& face,
+                                   UInt          glyph_index,
+                                   Int32         load_flags,
+                                   render_mode::RenderMode mode
+                                                = render_mode::NORMAL );
+
+        /// drop every glyph which was loaded from @p face
+        void purge( RefPtr<Face>& face );
+
+        /// return the glyph stored for a key, or NULL, without loading
+        /// anything. Counts as a hit or a miss.
+        using Lru_t::find;
+
+        /// return the glyph stored for a key, or NULL, without touching
+        /// the recency order or the counters
+        using Lru_t::peek;
+
+        /// append the key of every glyph held, most recently used first
+        using Lru_t::keys;
+
+        /// store a copy of a glyph under its key, replacing any existing
+        /// entry, and return the stored copy
+        using Lru_t::insert;
+
+        using Lru_t::clear;
+        using Lru_t::set_budget;
+        using Lru_t::budget;
+        using Lru_t::bytes;
+        using Lru_t::size;
+        using Lru_t::stats;
+        using Lru_t::reset_stats;
+};
+
+} // namespace freetype
+
+#endif // GLYPHCACHE_H_
@@ -0,0 +1,195 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/GlyphCacheFile.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_GLYPHCACHEFILE_H_
+#define CPPFREETYPE_GLYPHCACHEFILE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/GlyphCache.h>
+#include <cppfreetype/MappedFile.h>
+
+#include <map>
+#include <string>
+
+namespace freetype {
+
+/// identifies one face of one version of a font file
+/**
+ *  The size and modification time of the file are cheap to read, a hash of
+ *  its first 64 KiB catches a file replaced without changing either.
+ */
+struct FontFingerprint
+{
+    unsigned long long  size;           ///< bytes
+    long long           mtime_sec;      ///< modification time
+    long long           mtime_nsec;
+    unsigned long long  head_hash;      ///< FNV-1a of the first 64 KiB
+    long long           face_index;
+
+    FontFingerprint();
+
+    /// fingerprint face @p face_index of @p filepath
+    static RValuePair< FontFingerprint, Error > make( const char* filepath,
+                                                      Long face_index );
+
+    bool operator==( const FontFingerprint& other ) const;
+};
+
+/// a memory mapped file of rendered glyphs which survives restarts
+/**
+ *  save() writes the glyphs of a GlyphCache together with the fingerprint
+ *  of the font each was rendered from and the FreeType version. open()
+ *  maps such a file and checks only its header, so startup costs a single
+ *  mmap. Everything else is validated lazily: the fingerprint of a font is
+ *  compared the first time a glyph of one of its faces is asked for, and
+ *  each entry's bounds are checked when it is read. Files written by
+ *  another FreeType version, format version or byte order are rejected.
+ *
+ *  Faces are bound to the file they were opened from with attach(), since
+ *  a Face does not know its path. Glyphs are found by binary search over
+ *  entries sorted by key, and lookup() sits between a GlyphCache and
+ *  FreeType: cache, then file, then load and render.
+ *
+ *  The file is written to a temporary name and renamed over @p filepath,
+ *  so a mapping of the previous file stays valid.
+ *
+ *  @note   not thread safe
+ */
+class GlyphCacheFile
+{
+    public:
+        static const UInt32 VERSION = 1;    ///< format version
+
+        /// hit / miss counters
+        struct Stats
+        {
+            ULong   hits;       ///< glyphs read from the file
+            ULong   misses;     ///< glyphs not in the file
+            ULong   invalid;    ///< entries or fonts which failed checks
+
+            Stats();
+        };
+
+    private:
+        /// a face bound with attach()
+        struct Binding
+        {
+            std::string filepath;
+            Long        face_index;
+            Int         font;       ///< record in the file, or one of
+                                    ///  UNCHECKED / NO_MATCH
+        };
+
+        static const Int UNCHECKED = -2;
+        static const Int NO_MATCH  = -1;
+
+        typedef std::map< FT_Face, Binding > Map_t;
+
+        MappedFile* m_file;
+        const Byte* m_fonts;        ///< first font record
+        const Byte* m_entries;      ///< first entry record
+        UInt32      m_n_fonts;
+        UInt32      m_n_entries;
+        Map_t       m_bindings;
+        Stats       m_stats;
+
+        /// not copy-constructable
+        GlyphCacheFile( const GlyphCacheFile& );
+
+        /// not copy-assignable
+        GlyphCacheFile& operator=( const GlyphCacheFile& );
+
+        /// the font record of @p binding, checking its fingerprint the
+        /// first time
+        Int font( Binding& binding );
+
+    public:
+        GlyphCacheFile();
+        ~GlyphCacheFile();
+
+        /// map a file written by save(), closing any file already open
+        /**
+         *  @return 0, an error opening the file, FT_Err_Unknown_File_Format
+         *          if it is not a glyph cache file or is truncated, or
+         *          FT_Err_Invalid_Version if it was written by a different
+         *          format or FreeType version
+         */
+        Error open( const char* filepath );
+
+        /// unmap the file, bindings are kept
+        void close();
+
+        bool is_open() const;
+
+        /// bind @p face to face @p face_index of the font file it was
+        /// opened from
+        void attach( RefPtr<Face>& face, const char* filepath,
+                     Long face_index = 0 );
+
+        /// forget the binding of @p face, call before the face goes away
+        void detach( RefPtr<Face>& face );
+
+        /// copy the glyph stored for @p key into @p out
+        /**
+         *  @return false if the face of @p key is not attached, its font
+         *          changed since the file was written, or the file has no
+         *          valid entry for the key
+         */
+        bool find( const GlyphKey& key, CachedGlyph& out );
+
+        /// the glyph from @p cache, else from the file, else loaded and
+        /// rendered by @p cache, see GlyphCache::lookup()
+        const CachedGlyph* lookup( GlyphCache&   cache,
+                                   RefPtr<Face>& face,
+                                   UInt          glyph_index,
+                                   Int32         load_flags,
+                                   render_mode::RenderMode mode
+                                                = render_mode::NORMAL );
+
+        /// write every glyph of @p cache whose face is attached to
+        /// @p filepath
+        /**
+         *  @return 0, FT_Err_Cannot_Open_Stream if the file could not be
+         *          created or FT_Err_Invalid_Stream_Operation if writing
+         *          it failed
+         */
+        Error save( const char* filepath, const GlyphCache& cache );
+
+        /// number of glyphs in the open file
+        size_t size() const;
+
+        /// hit / miss counters
+        const Stats& stats() const;
+
+        /// zero the counters
+        void reset_stats();
+};
+
+} // namespace freetype
+
+#endif // GLYPHCACHEFILE_H_
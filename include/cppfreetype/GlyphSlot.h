@@ -34,6 +34,7 @@
 #include <cppfreetype/types.h>
 #include <cppfreetype/RefPtr.h>
 #include <cppfreetype/Outline.h>
+#include <cppfreetype/BitmapView.h>
 
 namespace freetype {
 
@@ -41,6 +42,10 @@ class GlyphSlot;
 class Library;
 class Face;
 
+/// metrics of a loaded glyph, in 26.6 pixels unless loaded with
+/// FT_LOAD_NO_SCALE
+typedef FT_Glyph_Metrics GlyphMetrics;
+
 class GlyphSlotDelegate
 {
     private:
@@ -84,6 +89,20 @@ class GlyphSlotDelegate
         void rsb_delta( Pos );
         Pos rsb_delta() const;
 
+        /// the bitmap of the slot, without copying it, valid until the
+        /// next load into the slot
+        BitmapView bitmap() const;
+
+        /// distance from the pen to the left edge of the bitmap, in pixels
+        Int bitmap_left() const;
+
+        /// distance from the baseline up to the top row of the bitmap, in
+        /// pixels
+        Int bitmap_top() const;
+
+        /// metrics of the loaded glyph, valid until the next load
+        const GlyphMetrics& metrics() const;
+
 };
 
 
@@ -96,6 +115,9 @@ struct GlyphSlot
     typedef FT_GlyphSlot        cobjptr;
 };
 
+template <> void RefPtr<GlyphSlot>::reference();
+template <> void RefPtr<GlyphSlot>::dereference();
+
 
 
 }
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/KerningTable.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_KERNINGTABLE_H_
+#define CPPFREETYPE_KERNINGTABLE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace freetype {
+
+/// every horizontal kerning pair of a face, scaled for one size
+/**
+ *  FT_Get_Kerning binary searches the kern table on every call. The table
+ *  extracts the pairs once, in font units, and scale() converts them for
+ *  the face's active size the same way FT_Get_Kerning does for the chosen
+ *  kerning_mode. Lookups are then a hash probe, or for pairs of glyphs in
+ *  the hot set (e.g. the glyphs of the scripts the layout handles most)
+ *  two array loads and a load from a dense matrix.
+ *
+ *  Like FreeType, only the 'kern' table is used, kerning from 'GPOS' is
+ *  not available.
+ */
+class KerningTable
+{
+    public:
+        typedef std::unordered_map< unsigned long long, Pos >   Map_t;
+
+    private:
+        Map_t               m_pairs;    ///< font units
+        Map_t               m_scaled;   ///< for the current size and mode
+        std::vector<UInt>   m_hot;      ///< glyph index to 1 + its row in
+                                        ///  the matrix, 0 if not hot
+        std::vector<Int32>  m_matrix;   ///< scaled hot pairs, row and
+                                        ///  column 0 are all zero
+        UInt                m_stride;   ///< 1 + number of hot glyphs
+        kerning_mode::KerningMode m_mode;
+
+        static unsigned long long key( UInt left, UInt right )
+        {
+            return ( (unsigned long long)left << 32 ) | right;
+        }
+
+        /// kerning of a pair which is not in the hot set
+        Pos get_cold( UInt left, UInt right ) const;
+
+        /// fill the matrix from m_scaled
+        void fill_matrix();
+
+    public:
+        KerningTable();
+
+        /// extract every pair from the 'kern' table of @p face
+        /**
+         *  Reads the horizontal format 0 subtables, summing or overriding
+         *  values across subtables the way FreeType does: an override
+         *  subtable replaces the value of the pairs it lists and leaves
+         *  the others as summed so far.
+         *
+         *  @return FT_Err_Table_Missing if the face has no 'kern' table,
+         *          or another error if it is not an SFNT face, in which
+         *          case use the glyph set overload
+         */
+        Error build( RefPtr<Face>& face );
+
+        /// extract the pairs among @p count glyphs by querying every pair
+        /// with FT_Get_Kerning, for faces without a 'kern' table (e.g.
+        /// Type 1 fonts with AFM metrics attached)
+        void build( RefPtr<Face>& face, const UInt* glyphs, size_t count );
+
+        /// choose the glyphs whose pairs are served from a dense matrix
+        /**
+         *  The matrix holds (count+1)^2 32 bit values, so keep the set to
+         *  a few hundred glyphs.
+         */
+        void set_hot_glyphs( const UInt* glyphs, size_t count );
+
+        /// convert the pairs for the active size of @p face
+        /**
+         *  Uses the size metrics of @p face, which need not be the face the
+         *  table was built from as long as it is the same font (e.g. the
+         *  same file opened by each thread of a LibraryPool).
+         */
+        void scale( RefPtr<Face>& face,
+                    kerning_mode::KerningMode mode = kerning_mode::DEFAULT );
+
+        /// horizontal kerning between @p left and @p right, as converted
+        /// by the last call to scale(), in font units before that
+        Pos get( UInt left, UInt right ) const
+        {
+            UInt l = left  < m_hot.size() ? m_hot[left]  : 0;
+            UInt r = right < m_hot.size() ? m_hot[right] : 0;
+            if( l && r )
+                return m_matrix[ l*m_stride + r ];
+            return get_cold( left, right );
+        }
+
+        /// the mode of the last call to scale()
+        kerning_mode::KerningMode mode() const;
+
+        /// all pairs in font units, keyed by left << 32 | right
+        const Map_t& pairs() const;
+
+        /// number of pairs
+        size_t size() const;
+
+        /// drop every pair and the hot set
+        void clear();
+};
+
+} // namespace freetype
+
+#endif // KERNINGTABLE_H_
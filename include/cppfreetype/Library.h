@@ -164,9 +164,53 @@ class LibraryDelegate
          *  See the discussion of reference counters in the description of
          *  FT_Reference_Face.
          */
-//        Face open_face( const OpenArgs& args,
-//                        Long_t          face_index,
-//                        Error_t&        error );
+        RefPtr<Face> open_face( const OpenArgs& args,
+                                Long            face_index );
+
+        /// same as open_face but also returns the FreeType error code
+        RValuePair< RefPtr<Face>, Error> open_face_e(
+                                const OpenArgs& args,
+                                Long            face_index );
+
+        /// open a face from a font file which is already in memory
+        /**
+         *  @param[in]  file_base   first byte of the font file
+         *  @param[in]  file_size   size of the font file in bytes
+         *  @param[in]  face_index  index of the face within the font
+         *
+         *  The data are not copied, the caller must keep them alive until
+         *  the face is destroyed.
+         */
+        RefPtr<Face> new_memory_face( const Byte* file_base,
+                                      Long        file_size,
+                                      Long        face_index );
+
+        /// same as new_memory_face but also returns the FreeType error code
+        RValuePair< RefPtr<Face>, Error> new_memory_face_e(
+                                      const Byte* file_base,
+                                      Long        file_size,
+                                      Long        face_index );
+
+        /// open a face from a read-only memory mapping of its font file
+        /**
+         *  @param[in]  filepath    path of the font file
+         *  @param[in]  face_index  index of the face within the font
+         *
+         *  The file is mapped once and the mapping is shared by every face
+         *  opened from it with this function, including the other faces of
+         *  a collection (TTC) file and faces in other libraries. Font tables
+         *  are read directly out of the mapping without copying. Each face
+         *  holds a reference to the mapping which is released when the last
+         *  RefPtr<Face> to it goes away, and the file is unmapped when no
+         *  face uses it.
+         */
+        RefPtr<Face> new_mapped_face( const char* filepath,
+                                      Long        face_index );
+
+        /// same as new_mapped_face but also returns the FreeType error code
+        RValuePair< RefPtr<Face>, Error> new_mapped_face_e(
+                                      const char* filepath,
+                                      Long        face_index );
 
 };
 
@@ -202,18 +246,26 @@ struct Library
      *  FT_Add_Default_Modules or a series of calls to FT_Add_Module)
      *  instead of FT_Init_FreeType to initialize the FreeType library.
      *
-     *  Don't use freetype::done but Library::done to destroy a
-     *  library instance.
+     *  Don't use freetype::done to destroy a library created this way,
+     *  release the last RefPtr to it instead.
      *
      *  @param[in]  memory  A handle to the original memory object
-     *  @param[out] error   FreeType error code. 0 means success
-     *  @return     A handle to a new library object
+     *  @return     A handle to a new library object, with no modules
      *  @note       See the discussion of reference counters in the
      *              description of FT_Reference_Library.
+     *  @note       The library is destroyed when the last RefPtr to it goes
+     *              away. The memory object is not, destroy it with
+     *              Memory::destroy after that.
      */
-    //static RefPtr<Library> create( RefPtr<Memory> memory, Error_t& error );
+    static RefPtr<Library> create( Memory memory );
+
+    /// same as create but also returns the FreeType error code
+    static RValuePair< RefPtr<Library>, Error > create_e( Memory memory );
 };
 
+template <> void RefPtr<Library>::reference();
+template <> void RefPtr<Library>::dereference();
+
 
 
 
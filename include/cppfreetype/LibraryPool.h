@@ -0,0 +1,182 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/LibraryPool.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_LIBRARYPOOL_H_
+#define CPPFREETYPE_LIBRARYPOOL_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/Library.h>
+#include <cppfreetype/Memory.h>
+#include <cppfreetype/SlabAllocator.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace freetype {
+
+/// lazily creates one Library per thread, each with its own copy of the
+/// same face
+/**
+ *  FreeType objects are not thread safe, so each thread which loads glyphs
+ *  needs its own Library object and its own Face opened from it. The pool
+ *  creates them the first time a thread asks for them and hands out the
+ *  calling thread's face, so worker threads never share FreeType state and
+ *  glyph loading does not serialize.
+ *
+ *  The only shared state is the map from thread to library, which is
+ *  consulted under a mutex the first time a thread calls into a given pool.
+ *  After that the thread's slot is remembered in a thread local, so
+ *  repeated calls from the same thread do not lock.
+ *
+ *  Each thread's library allocates from its own SlabAllocator, so the
+ *  blocks FreeType allocates and frees while loading glyphs, and the
+ *  images of Glyph objects taken from the pool's faces, are recycled
+ *  within the thread rather than churning the shared heap. A Glyph holds
+ *  its own reference to the library, so it may outlive the pool, the
+ *  allocator goes with the last block the library frees.
+ *
+ *  @note   a face handed out by the pool must only be used, copied and
+ *          released on the thread which obtained it
+ *  @note   the pool must outlive all of its worker threads' use of the
+ *          faces, the destructor releases every library
+ */
+class LibraryPool
+{
+    public:
+        /// the allocator behind one thread's library
+        /**
+         *  Forwards to a SlabAllocator. Once the pool has let go of the
+         *  library, the arena destroys itself and its memory handle when
+         *  the library frees its last block, which is when it dies.
+         */
+        class Arena
+        {
+            private:
+                SlabAllocator   m_slab;
+                Memory          m_memory;
+                bool            m_released;
+
+                /// not copy-constructable
+                Arena( const Arena& );
+
+                /// not copy-assignable
+                Arena& operator=( const Arena& );
+
+                /// only release() destroys an arena
+                ~Arena();
+
+            public:
+                Arena();
+
+                /// allocator policy interface, see MallocAllocator
+                void* alloc( long size );
+                void  free( void* block );
+                void* realloc( long cur_size, long new_size, void* block );
+
+                /// the memory handle libraries are created with
+                Memory memory();
+
+                /// called once the pool has dropped its references to the
+                /// library, destroys the arena now if nothing is allocated
+                /// or else with the last call to free()
+                void release();
+        };
+
+        /// the library and face belonging to one thread
+        struct Slot
+        {
+            Arena*          arena;      ///< backs the library's memory
+            RefPtr<Library> library;
+            RefPtr<Face>    face;
+            Error           error;      ///< result of creating the slot
+
+            Slot();
+
+            /// drops the face and library and releases the arena
+            ~Slot();
+        };
+
+    private:
+        typedef std::map< std::thread::id, Slot* >   Map_t;
+
+        std::string     m_filepath;
+        Long            m_face_index;
+        ULong           m_id;       ///< unique id used to validate the
+                                    ///  thread local slot cache
+        std::mutex      m_mutex;
+        Map_t           m_slots;
+
+        /// not copy-constructable
+        LibraryPool( const LibraryPool& );
+
+        /// not copy-assignable
+        LibraryPool& operator=( const LibraryPool& );
+
+        /// return the calling thread's slot, creating it if necessary
+        Slot* local();
+
+    public:
+        /// create a pool which opens face @p face_index of @p filepath in
+        /// each thread
+        LibraryPool( const char* filepath, Long face_index=0 );
+
+        /// releases every thread's face and library, libraries still
+        /// referenced (e.g. by a Glyph) live on until their last reference
+        /// is released, which must not happen concurrently with this
+        ~LibraryPool();
+
+        /// the calling thread's face, NULL if it could not be opened
+        RefPtr<Face> face();
+
+        /// the calling thread's face and the error from opening it
+        RValuePair< RefPtr<Face>, Error > face_e();
+
+        /// the calling thread's library
+        RefPtr<Library> library();
+
+        /// drop the calling thread's face and library
+        /**
+         *  Slots are otherwise kept until the pool is destroyed, so threads
+         *  which come and go (e.g. the workers of one batch job) should
+         *  call this before they exit. A later call from the same thread
+         *  opens a new library.
+         */
+        void release();
+
+        /// number of threads which have a library in this pool
+        size_t size();
+
+        const char* filepath() const;
+        Long        face_index() const;
+};
+
+} // namespace freetype
+
+#endif // LIBRARYPOOL_H_
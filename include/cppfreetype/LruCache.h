@@ -0,0 +1,288 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/LruCache.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_LRUCACHE_H_
+#define CPPFREETYPE_LRUCACHE_H_
+
+#include <cppfreetype/types.h>
+
+#include <list>
+#include <vector>
+#include <unordered_map>
+
+namespace freetype {
+
+/// size policy for LruCache which asks the value, Value::bytes() returns
+/// the heap memory it holds
+struct LruValueBytes
+{
+    template <class Value>
+    size_t operator()( const Value& value ) const
+    {
+        return value.bytes();
+    }
+};
+
+/// least-recently-used map with a byte budget, the storage behind
+/// GlyphCache, FlattenCache and RunCache
+/**
+ *  Entries live in a list, most recently used first, indexed by a hash map
+ *  from key to list position. When the bytes held exceed the budget the
+ *  entries at the back of the list are evicted, except the front one, so
+ *  the entry just added always survives.
+ *
+ *  A cache which builds values on a miss fills them in place: prepare()
+ *  puts a new entry at the front of the list, and commit() adds it to the
+ *  map or discard() drops it if building the value failed.
+ *
+ *  @tparam Key     key type, copyable and comparable with ==
+ *  @tparam Value   value type, default constructable
+ *  @tparam Hash    hash functor for Key
+ *  @tparam Size    functor returning the heap bytes held by a Value
+ */
+template <class Key, class Value, class Hash, class Size = LruValueBytes>
+class LruCache
+{
+    public:
+        /// hit / miss counters
+        struct Stats
+        {
+            ULong   hits;       ///< lookups served from the cache
+            ULong   misses;     ///< lookups which did not find the key
+            ULong   evictions;  ///< entries dropped to respect the budget
+            ULong   insertions; ///< entries added to the cache
+
+            Stats():
+                hits(0),
+                misses(0),
+                evictions(0),
+                insertions(0)
+            {}
+        };
+
+        struct Entry
+        {
+            Key     key;
+            Value   value;
+        };
+
+    private:
+        typedef std::list<Entry>                                List_t;
+        typedef std::unordered_map< Key,
+                                    typename List_t::iterator,
+                                    Hash >                      Map_t;
+
+        List_t  m_lru;      ///< most recently used at the front
+        Map_t   m_map;      ///< key to position in m_lru
+        size_t  m_budget;   ///< maximum number of bytes to hold
+        size_t  m_bytes;    ///< number of bytes currently held
+        Stats   m_stats;
+
+        /// not copy-constructable
+        LruCache( const LruCache& );
+
+        /// not copy-assignable
+        LruCache& operator=( const LruCache& );
+
+        /// approximate memory cost of an entry
+        static size_t cost( const Entry& entry )
+        {
+            // the entry itself, one list node, and roughly one hash node
+            // + bucket
+            return sizeof(Entry) + 4*sizeof(void*)
+                 + sizeof(Key) + 4*sizeof(void*)
+                 + Size()( entry.value );
+        }
+
+        /// evict from the back of the list until we are within budget,
+        /// but never evict the front entry
+        void trim()
+        {
+            while( m_bytes > m_budget && m_lru.size() > 1 )
+            {
+                Entry& victim = m_lru.back();
+                m_bytes -= cost(victim);
+                m_map.erase(victim.key);
+                m_lru.pop_back();
+                ++m_stats.evictions;
+            }
+        }
+
+    public:
+        /// create a cache which holds at most @p budget bytes
+        explicit LruCache( size_t budget ):
+            m_budget(budget),
+            m_bytes(0)
+        {}
+
+        /// return the value stored for @p key, or NULL. Counts as a hit or
+        /// a miss, and a hit becomes the most recently used entry.
+        const Value* find( const Key& key )
+        {
+            typename Map_t::iterator iter = m_map.find(key);
+            if( iter == m_map.end() )
+            {
+                ++m_stats.misses;
+                return 0;
+            }
+
+            ++m_stats.hits;
+            m_lru.splice( m_lru.begin(), m_lru, iter->second );
+            return &(iter->second->value);
+        }
+
+        /// return the value stored for @p key, or NULL, without touching
+        /// the recency order or the counters
+        const Value* peek( const Key& key ) const
+        {
+            typename Map_t::const_iterator iter = m_map.find(key);
+            return iter == m_map.end() ? 0 : &(iter->second->value);
+        }
+
+        /// append the key of every entry held, most recently used first
+        void keys( std::vector<Key>& out ) const
+        {
+            out.reserve( out.size() + m_lru.size() );
+            for( typename List_t::const_iterator iter = m_lru.begin();
+                    iter != m_lru.end(); ++iter )
+                out.push_back( iter->key );
+        }
+
+        /// store a copy of @p value under @p key, replacing any existing
+        /// entry, and return the stored copy
+        const Value* insert( const Key& key, const Value& value )
+        {
+            typename Map_t::iterator iter = m_map.find(key);
+            if( iter != m_map.end() )
+            {
+                m_bytes -= cost( *(iter->second) );
+                m_lru.erase(iter->second);
+                m_map.erase(iter);
+            }
+
+            Entry& entry = prepare(key);
+            entry.value  = value;
+            commit();
+            return &entry.value;
+        }
+
+        /// start a new entry for @p key at the front of the list, which is
+        /// not found by lookups until it is passed to commit()
+        /**
+         *  The key may be changed before commit(), e.g. to point it at data
+         *  owned by the value. It must not be in the cache already.
+         */
+        Entry& prepare( const Key& key )
+        {
+            m_lru.push_front( Entry() );
+            m_lru.front().key = key;
+            return m_lru.front();
+        }
+
+        /// add the entry started by prepare() to the cache, evicting
+        /// others if necessary
+        void commit()
+        {
+            Entry& entry = m_lru.front();
+            m_map[entry.key] = m_lru.begin();
+            m_bytes += cost(entry);
+            ++m_stats.insertions;
+            trim();
+        }
+
+        /// drop the entry started by prepare()
+        void discard()
+        {
+            m_lru.pop_front();
+        }
+
+        /// drop every entry whose key @p match returns true for
+        template <class Match>
+        void erase_if( const Match& match )
+        {
+            for( typename List_t::iterator iter = m_lru.begin();
+                    iter != m_lru.end(); )
+            {
+                if( match(iter->key) )
+                {
+                    m_bytes -= cost(*iter);
+                    m_map.erase(iter->key);
+                    iter = m_lru.erase(iter);
+                }
+                else
+                    ++iter;
+            }
+        }
+
+        /// drop every entry
+        void clear()
+        {
+            m_map.clear();
+            m_lru.clear();
+            m_bytes = 0;
+        }
+
+        /// change the byte budget, evicting entries if necessary
+        void set_budget( size_t budget )
+        {
+            m_budget = budget;
+            trim();
+        }
+
+        /// the byte budget
+        size_t budget() const
+        {
+            return m_budget;
+        }
+
+        /// number of bytes currently held
+        size_t bytes() const
+        {
+            return m_bytes;
+        }
+
+        /// number of entries currently held
+        size_t size() const
+        {
+            return m_map.size();
+        }
+
+        /// hit / miss / eviction counters
+        const Stats& stats() const
+        {
+            return m_stats;
+        }
+
+        /// zero the counters
+        void reset_stats()
+        {
+            m_stats = Stats();
+        }
+};
+
+} // namespace freetype
+
+#endif // LRUCACHE_H_
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/MappedFile.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_MAPPEDFILE_H_
+#define CPPFREETYPE_MAPPEDFILE_H_
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/AssignmentPair.h>
+
+namespace freetype {
+
+/// a read-only, reference counted memory mapping of a whole file
+/**
+ *  Mappings are shared: opening a file which is already mapped (the same
+ *  device and inode, whatever the path used to reach it) returns the
+ *  existing mapping with its reference count increased. The file is
+ *  unmapped when the last reference is released.
+ *
+ *  Opening and releasing are thread safe.
+ */
+class MappedFile
+{
+    private:
+        const Byte*         m_data;
+        Long                m_size;
+        ULong               m_refs;     ///< guarded by the registry lock
+        unsigned long long  m_device;
+        unsigned long long  m_inode;
+        long long           m_mtime_sec;    ///< modification time, when
+        long long           m_mtime_nsec;   ///  mapped
+
+        MappedFile();
+        ~MappedFile();
+
+        /// not copy-constructable
+        MappedFile( const MappedFile& );
+
+        /// not copy-assignable
+        MappedFile& operator=( const MappedFile& );
+
+    public:
+        /// map @p filepath, or share its existing mapping
+        /**
+         *  A mapping is shared while the file keeps its size and
+         *  modification time. A file rewritten in place is mapped afresh,
+         *  and faces opened before keep the old mapping.
+         *
+         *  @return the mapping, holding one reference which the caller
+         *          must give back with release(), and a FreeType error code.
+         *          The mapping is NULL if the error is not 0.
+         */
+        static RValuePair< MappedFile*, Error > open( const char* filepath );
+
+        /// add a reference
+        void reference();
+
+        /// drop a reference, unmapping the file when it was the last one
+        void release();
+
+        /// first byte of the file
+        const Byte* data() const;
+
+        /// size of the file in bytes
+        Long        size() const;
+
+        /// number of files currently mapped by this process
+        static size_t num_mapped();
+};
+
+} // namespace freetype
+
+#endif // MAPPEDFILE_H_
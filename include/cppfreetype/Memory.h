@@ -27,11 +27,71 @@
 #ifndef CPPFREETYPE_MEMORY_H_
 #define CPPFREETYPE_MEMORY_H_
 
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
 #include <cppfreetype/types.h>
 
+#include <cstdlib>
+
 namespace freetype
 {
 
+/// allocator policy which forwards to the C library, the same thing
+/// FreeType does by default
+/**
+ *  An allocator policy is any class with the three members below. It is
+ *  plugged into a memory manager with Memory::create<Allocator>(), which
+ *  calls the members directly from FreeType's hooks without any
+ *  type-erased dispatch.
+ */
+struct MallocAllocator
+{
+    /// return a block of @p size bytes or 0 on failure
+    void* alloc( long size )
+    {
+        return std::malloc( size );
+    }
+
+    /// release a block returned by alloc() or realloc()
+    void free( void* block )
+    {
+        std::free( block );
+    }
+
+    /// resize @p block from @p cur_size to @p new_size bytes, return 0 and
+    /// leave the block intact on failure
+    void* realloc( long cur_size, long new_size, void* block )
+    {
+        (void)cur_size;
+        return std::realloc( block, new_size );
+    }
+};
+
+/// hooks installed in an FT_MemoryRec_ by Memory::create<Allocator>
+namespace memory_hook
+{
+    template <class Allocator>
+    void* alloc( FT_Memory memory, long size )
+    {
+        return static_cast<Allocator*>( memory->user )->alloc( size );
+    }
+
+    template <class Allocator>
+    void free( FT_Memory memory, void* block )
+    {
+        static_cast<Allocator*>( memory->user )->free( block );
+    }
+
+    template <class Allocator>
+    void* realloc( FT_Memory memory, long cur_size, long new_size,
+                   void* block )
+    {
+        return static_cast<Allocator*>( memory->user )
+                    ->realloc( cur_size, new_size, block );
+    }
+}
+
 
 /// A handle to a given memory manager object, defined with an
 /// FT_MemoryRec structure.
@@ -54,14 +114,57 @@ class Memory
 
         /// destroys the underlying FT_Memory object, make sure it is only
         /// called on one copy of the handle
+        /**
+         *  @note   an allocator passed to create<Allocator> is not owned by
+         *          the memory manager and is not destroyed
+         */
         void destroy();
 
         /// create a new memory management handle which wraps the
         /// provided memory management slots
+        /**
+         *  @note   every allocation made by FreeType through this manager
+         *          goes through a sigc::slot call, use create<Allocator>
+         *          for allocators on a hot path
+         */
         static Memory create(   AllocFunc_t     alloc,
                                 FreeFunc_t      free,
                                 ReallocFunc_t   realloc );
 
+        /// create a new memory management handle from plain C functions,
+        /// which are installed directly in the FT_MemoryRec_
+        /**
+         *  @param[in]  alloc   allocation function
+         *  @param[in]  free    deallocation function
+         *  @param[in]  realloc reallocation function
+         *  @param[in]  user    passed to the functions as `memory->user`
+         */
+        static Memory create(   FT_Alloc_Func   alloc,
+                                FT_Free_Func    free,
+                                FT_Realloc_Func realloc,
+                                void*           user );
+
+        /// create a new memory management handle which calls the members
+        /// of @p allocator directly
+        /**
+         *  The hooks are instantiated for the concrete allocator type, so a
+         *  FreeType allocation costs one indirect call into a function which
+         *  calls Allocator::alloc statically, and can inline it.
+         *
+         *  @param[in]  allocator   the allocator policy, must outlive every
+         *                          library created with the returned handle
+         *
+         *  @see MallocAllocator for the required interface
+         */
+        template <class Allocator>
+        static Memory create( Allocator* allocator )
+        {
+            return create( &memory_hook::alloc<Allocator>,
+                           &memory_hook::free<Allocator>,
+                           &memory_hook::realloc<Allocator>,
+                           static_cast<void*>( allocator ) );
+        }
+
 };
 
 
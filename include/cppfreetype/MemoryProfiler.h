@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/MemoryProfiler.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_MEMORYPROFILER_H_
+#define CPPFREETYPE_MEMORYPROFILER_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/Memory.h>
+
+#include <map>
+#include <string>
+
+namespace freetype {
+
+/// a snapshot of the memory traffic seen by a MemoryProfiler
+struct MemoryStats
+{
+    /// number of size classes in the histogram
+    /**
+     *  bucket 0 counts requests of at most one byte, bucket b counts
+     *  requests of (2^(b-1), 2^b] bytes and the last bucket also counts
+     *  everything larger
+     */
+    static const UInt NUM_BUCKETS = 24;
+
+    Long    live_bytes;         ///< bytes currently allocated
+    Long    live_blocks;        ///< blocks currently allocated
+    Long    peak_bytes;         ///< high water mark of live_bytes
+    ULong   alloc_calls;        ///< calls to alloc()
+    ULong   free_calls;         ///< calls to free()
+    ULong   realloc_calls;      ///< calls to realloc()
+    ULong   realloc_grow;       ///< reallocs to a larger size
+    ULong   realloc_shrink;     ///< reallocs to a smaller size
+    ULong   realloc_moved;      ///< reallocs which returned a new address
+    ULong   bytes_allocated;    ///< total bytes requested, including growth
+    ULong   histogram[NUM_BUCKETS]; ///< allocations and reallocs by new size
+
+    MemoryStats();
+
+    /// the traffic between @p before and this snapshot
+    /**
+     *  Counters are differences, live_bytes and live_blocks are the net
+     *  change, and peak_bytes is the high water mark above the live bytes of
+     *  @p before, if the profiler's peak was reset when @p before was taken
+     *  (as MemoryPhase does).
+     */
+    MemoryStats since( const MemoryStats& before ) const;
+
+    /// histogram bucket for a request of @p size bytes
+    static UInt bucket( long size );
+};
+
+/// totals accumulated over every run of a named MemoryPhase
+struct PhaseStats
+{
+    ULong   runs;               ///< number of completed phases
+    Long    net_bytes;          ///< sum of the live byte changes
+    Long    max_peak_bytes;     ///< largest peak above the starting bytes
+    ULong   alloc_calls;        ///< sum of calls to alloc()
+    ULong   free_calls;         ///< sum of calls to free()
+    ULong   realloc_calls;      ///< sum of calls to realloc()
+    ULong   bytes_allocated;    ///< sum of bytes requested
+
+    PhaseStats();
+
+    /// add one run
+    void add( const MemoryStats& delta );
+};
+
+/// allocator policy which counts the memory traffic of a FreeType library
+/**
+ *  Install it with Memory::create<MemoryProfiler>() and create the library
+ *  to observe with Library::create(). Blocks come from the C library with a
+ *  small header recording their size, which FreeType does not pass to
+ *  free(), and every hook updates a handful of plain counters, so the
+ *  profiler is cheap enough to leave on in production.
+ *
+ *  @code
+MemoryProfiler  profiler;
+Memory          memory  = Memory::create( &profiler );
+RefPtr<Library> library = Library::create( memory );
+library->add_default_modules();
+
+RefPtr<Face> face;
+{
+    MemoryPhase phase( profiler, "open face" );
+    face = library->new_face( "DejaVuSans.ttf", 0 );
+}
+...
+const PhaseStats& open = profiler.phases()["open face"];
+@endcode
+ *
+ *  @note   the profiler is not thread safe, give each thread's library its
+ *          own profiler
+ */
+class MemoryProfiler
+{
+    public:
+        typedef std::map< std::string, PhaseStats > PhaseMap_t;
+
+    private:
+        MemoryStats     m_stats;
+        PhaseMap_t      m_phases;
+
+        /// not copy-constructable
+        MemoryProfiler( const MemoryProfiler& );
+
+        /// not copy-assignable
+        MemoryProfiler& operator=( const MemoryProfiler& );
+
+    public:
+        MemoryProfiler();
+
+        /// allocator policy interface, see MallocAllocator
+        void* alloc( long size );
+        void  free( void* block );
+        void* realloc( long cur_size, long new_size, void* block );
+
+        /// the counters as of now
+        const MemoryStats& stats() const;
+
+        /// set the high water mark to the current live bytes, and return
+        /// the previous high water mark
+        Long reset_peak();
+
+        /// raise the high water mark to at least @p peak
+        void restore_peak( Long peak );
+
+        /// zero the counters, leaving the live and peak bytes
+        void reset_stats();
+
+        /// totals of the named phases which have completed
+        PhaseMap_t& phases();
+
+        /// add a completed phase to the totals for @p name
+        void record( const std::string& name, const MemoryStats& delta );
+};
+
+/// scoped measurement of the traffic seen by a MemoryProfiler
+/**
+ *  Takes a snapshot on construction and resets the profiler's high water
+ *  mark, so the peak of the delta is the peak reached inside the phase.
+ *  Phases may be nested, the outer high water mark is restored when the
+ *  inner phase ends. If a name is given the delta is added to the
+ *  profiler's phase totals on destruction.
+ */
+class MemoryPhase
+{
+    private:
+        MemoryProfiler& m_profiler;
+        std::string     m_name;
+        MemoryStats     m_start;
+        Long            m_outer_peak;
+
+        /// not copy-constructable
+        MemoryPhase( const MemoryPhase& );
+
+        /// not copy-assignable
+        MemoryPhase& operator=( const MemoryPhase& );
+
+    public:
+        explicit MemoryPhase( MemoryProfiler& profiler, const char* name = 0 );
+
+        /// records the phase if it was named
+        ~MemoryPhase();
+
+        /// traffic since the phase started
+        MemoryStats stats() const;
+};
+
+} // namespace freetype
+
+#endif // MEMORYPROFILER_H_
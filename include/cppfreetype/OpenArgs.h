@@ -27,12 +27,24 @@
 #ifndef CPPFREETYPE_OPENARGS_H_
 #define CPPFREETYPE_OPENARGS_H_
 
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
 #include <cppfreetype/types.h>
 #include <cppfreetype/Module.h>
 
 namespace freetype
 {
 
+/// bit flags for the `flags` field of OpenArgs
+namespace open_flag
+{
+    const UInt_t MEMORY     = FT_OPEN_MEMORY;   ///< memory_base is valid
+    const UInt_t STREAM     = FT_OPEN_STREAM;   ///< stream is valid
+    const UInt_t PATHNAME   = FT_OPEN_PATHNAME; ///< pathname is valid
+    const UInt_t DRIVER     = FT_OPEN_DRIVER;   ///< driver is valid
+    const UInt_t PARAMS     = FT_OPEN_PARAMS;   ///< params are valid
+}
 
 /// A structure used to indicate how to open a new font file or stream. A
 /// pointer to such a structure can be used as a parameter for the functions
@@ -66,9 +78,16 @@ namespace freetype
 class OpenArgs
 {
     private:
-        void* m_ptr;    ///< pointer to the underlying object
+        FT_Open_Args m_args;    ///< the underlying object
 
     public:
+        /// creates an empty set of arguments, all fields zero
+        OpenArgs();
+
+        /// return the underlying FT_Open_Args structure
+        FT_Open_Args*       get_ptr();
+        const FT_Open_Args* get_ptr() const;
+
         /// A set of bit flags indicating how to use the structure.
         UInt_t&         flags();
 
@@ -82,19 +101,33 @@ class OpenArgs
         String_t*&      pathname();
 
         /// A handle to a source stream object.
-        //Stream&        stream;
+        FT_Stream&      stream();
 
         /// This field is exclusively used by FT_Open_Face; it simply
         /// specifies the font driver to use to open the face. If set to 0,
         /// FreeType tries to load the face with each one of the drivers in
         /// its list.
-        Module&         driver();
+        FT_Module&      driver();
 
         /// The number of extra parameters.
         Int_t&          num_params();
 
         /// Extra parameters passed to the font driver when opening a new face.
-        //Parameter*&     params();
+        FT_Parameter*&  params();
+
+        /// arguments for a font file which is already in memory
+        /**
+         *  The data are not copied, and must stay valid until the face
+         *  opened from them is destroyed.
+         */
+        static OpenArgs memory( const Byte_t* base, Long_t size );
+
+        /// arguments for a font file on disk, read through FreeType's
+        /// default stream
+        static OpenArgs path( const char* filepath );
+
+        /// arguments for a custom stream
+        static OpenArgs custom_stream( FT_Stream stream );
 };
 
 } // namespace freetype 
@@ -89,6 +89,52 @@ struct ContourIterator:
 
 
 
+/// read-only view of the arrays of an FT_Outline
+/**
+ *  Unlike the iterators, which make an out-of-line call for every
+ *  coordinate and re-read the tag byte for every query, the view exposes
+ *  the outline's own arrays so that a whole glyph can be processed in one
+ *  pass. The accessors are inline.
+ *
+ *  The view points into the outline and is invalidated when the glyph slot
+ *  it came from is loaded again. Use CompactOutline to keep a copy.
+ */
+struct OutlineView
+{
+    const FT_Vector*    points;     ///< n_points points
+    const char*         tags;       ///< n_points tags, see curve_tag
+    const Short*        contours;   ///< index of the last point of each
+                                    ///  contour
+    Int                 n_points;
+    Int                 n_contours;
+    Int                 flags;      ///< outline flags, FT_OUTLINE_XXX
+
+    OutlineView();
+
+    Pos  x( Int i ) const   { return points[i].x; }
+    Pos  y( Int i ) const   { return points[i].y; }
+
+    /// curve tag of point @p i, the dropout bits are masked out
+    UInt tag( Int i ) const { return tags[i] & 0x03; }
+
+    bool on( Int i ) const      { return tags[i] & 0x01; }
+    bool conic( Int i ) const   { return (tags[i] & 0x03) == curve_tag::CONIC; }
+    bool cubic( Int i ) const   { return (tags[i] & 0x03) == curve_tag::CUBIC; }
+
+    /// index of the first point of contour @p c
+    Int contour_begin( Int c ) const
+    {
+        return c > 0 ? contours[c-1] + 1 : 0;
+    }
+
+    /// one past the index of the last point of contour @p c
+    Int contour_end( Int c ) const
+    {
+        return contours[c] + 1;
+    }
+};
+
+
 class OutlineDelegate
 {
     private:
@@ -117,6 +163,9 @@ class OutlineDelegate
         Short   n_contours() const;
         Short   n_points()   const;
 
+        /// the outline's arrays, see OutlineView
+        OutlineView view() const;
+
 
 
 };
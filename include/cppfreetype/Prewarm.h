@@ -0,0 +1,154 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/Prewarm.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_PREWARM_H_
+#define CPPFREETYPE_PREWARM_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/AssignmentPair.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/GlyphCache.h>
+#include <cppfreetype/LibraryPool.h>
+
+#include <utility>
+#include <vector>
+
+namespace freetype {
+
+/// a set of character codes: ranges, or everything in a face's charmap
+class Charset
+{
+    public:
+        typedef std::pair<ULong,ULong>  Range_t;    ///< first, last
+
+    private:
+        std::vector<Range_t>    m_ranges;
+        bool                    m_all;
+
+    public:
+        /// an empty set
+        Charset();
+
+        /// every character of the face's charmap
+        static Charset all();
+
+        /// the characters @p first to @p last, inclusive
+        static Charset range( ULong first, ULong last );
+
+        /// add the characters @p first to @p last, inclusive
+        void add( ULong first, ULong last );
+
+        /// add one character
+        void add( ULong charcode );
+
+        /// include every character of the face's charmap
+        void add_all();
+
+        /// add the characters listed in a text file
+        /**
+         *  The file holds character codes and ranges separated by white
+         *  space or commas. A code is written U+0041, 0x41 or 65, a range
+         *  is two codes joined by '-' or "..", and '#' starts a comment
+         *  which runs to the end of the line.
+         *
+         *  @return 0, an error opening the file, or FT_Err_Invalid_Argument
+         *          at the first token which is not a code or a range, in
+         *          which case the codes before it have been added
+         */
+        Error load( const char* filepath );
+
+        /// add the characters listed in @p length bytes of @p text, in the
+        /// format of load()
+        Error parse( const char* text, size_t length );
+
+        /// the ranges added so far
+        const std::vector<Range_t>& ranges() const;
+
+        /// whether the set is the whole charmap
+        bool is_all() const;
+
+        /// the distinct glyphs of @p face which the set maps to, sorted,
+        /// not including the missing glyph
+        void glyphs( RefPtr<Face>& face, std::vector<UInt>& out ) const;
+};
+
+/// render a charset at several sizes on a pool of threads and store the
+/// bitmaps in a cache
+/**
+ *  The glyphs of @p charset are looked up in @p face, then every (size,
+ *  glyph) pair is loaded and rendered by @p threads workers, each with the
+ *  face of its own Library from @p pool, so FreeType objects are never
+ *  shared between threads. Each worker keeps its bitmaps to itself and
+ *  they are inserted into @p cache after the workers have joined, keyed as
+ *  if they had been loaded from @p face at that pixel size, so later
+ *  lookups of @p face hit.
+ *
+ *  @param[in]  pool        opens the same font file and face index as
+ *                          @p face
+ *  @param[in]  face        the face the cache entries are keyed to, its
+ *                          active size is not changed
+ *  @param[in]  sizes       pixel sizes, as passed to set_pixel_sizes()
+ *  @param[in]  n_sizes     number of sizes
+ *  @param[in]  charset     characters to render
+ *  @param[in]  threads     number of workers, 0 for one per hardware
+ *                          thread
+ *  @param[out] cache       receives the bitmaps, not touched by the
+ *                          workers
+ *  @param[in]  load_flags  flags passed to load_glyph
+ *  @param[in]  mode        render mode, see GlyphCache::lookup()
+ *
+ *  @return the number of glyphs inserted into the cache and the first
+ *          error met, glyphs which failed are skipped
+ *
+ *  @note   each worker releases its library from the pool when it is
+ *          done, so repeated calls do not grow the pool
+ */
+RValuePair< size_t, Error > prewarm_e( LibraryPool&    pool,
+                                       RefPtr<Face>&   face,
+                                       const UInt*     sizes,
+                                       size_t          n_sizes,
+                                       const Charset&  charset,
+                                       UInt            threads,
+                                       GlyphCache&     cache,
+                                       Int32           load_flags = 0,
+                                       render_mode::RenderMode mode
+                                                = render_mode::NORMAL );
+
+/// same as prewarm_e() but only returns the number of glyphs inserted
+size_t prewarm( LibraryPool&    pool,
+                RefPtr<Face>&   face,
+                const UInt*     sizes,
+                size_t          n_sizes,
+                const Charset&  charset,
+                UInt            threads,
+                GlyphCache&     cache,
+                Int32           load_flags = 0,
+                render_mode::RenderMode mode = render_mode::NORMAL );
+
+} // namespace freetype
+
+#endif // PREWARM_H_
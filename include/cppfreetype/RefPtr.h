@@ -47,6 +47,10 @@ class RefPtr
         Storage m_ptr;
 
         /// increase reference count by one, see specializations
+        /**
+         *  Specializations must be declared in the traits class's header,
+         *  or other translation units instantiate these empty defaults.
+         */
         void reference(){}
 
         /// decrease reference count by one, see specializations
@@ -0,0 +1,162 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/RunCache.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_RUNCACHE_H_
+#define CPPFREETYPE_RUNCACHE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/AssignmentPair.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/TextLayout.h>
+#include <cppfreetype/LruCache.h>
+
+#include <string>
+
+namespace freetype {
+
+/// identifies one laid out string: the text, the face and the size it was
+/// laid out at, and the layout parameters
+/**
+ *  The key does not own the text. Keys stored in a RunCache point at the
+ *  copy of the text held by their entry, keys built for a lookup point at
+ *  the caller's buffer, so a hit does not allocate.
+ */
+struct RunKey
+{
+    FT_Face     face;           ///< face the text was laid out with
+    UShort      x_ppem;         ///< horizontal pixels per EM
+    UShort      y_ppem;         ///< vertical pixels per EM
+    Fixed       x_scale;        ///< 16.16 font-unit to 26.6 scale
+    Fixed       y_scale;        ///< 16.16 font-unit to 26.6 scale
+    Int32       load_flags;     ///< flags the advances were read with
+    Int         kerning_mode;   ///< kerning_mode::KerningMode used
+    Pos         max_width;      ///< line width limit, 0 for none
+    const char* text;           ///< the UTF-8 text, not owned
+    size_t      length;         ///< number of bytes of text
+    size_t      hash;           ///< hash of all of the above
+
+    RunKey();
+
+    /// build a key for @p layout at the face's currently active size
+    static RunKey make( TextLayout& layout,
+                        const char* utf8,
+                        size_t      length,
+                        Pos         max_width );
+
+    /// compares every field and the bytes of the text
+    bool operator==( const RunKey& other ) const;
+};
+
+/// hash functor for RunKey, returns the hash computed by RunKey::make
+struct RunKeyHash
+{
+    size_t operator()( const RunKey& key ) const;
+};
+
+/// a laid out string held by a RunCache
+struct CachedRun
+{
+    std::string text;   ///< the key's text points here
+    GlyphRun    run;
+
+    /// number of bytes of heap memory held
+    size_t bytes() const;
+};
+
+/// least-recently-used cache of laid out strings
+/**
+ *  Sits in front of a TextLayout: a lookup of a string which was already
+ *  laid out with the same face, size, flags and maximum width returns the
+ *  stored GlyphRun (whose bbox() is the layout box) without decoding or
+ *  measuring the text again. Keys compare the text itself, not only its
+ *  hash, so a collision can not return the wrong run.
+ *
+ *  Works like GlyphCache, with the same caveats: entries are keyed by the
+ *  FT_Face pointer so purge() a face before it goes away, returned pointers
+ *  are valid until the next call which may insert or evict, and the cache
+ *  is not thread safe.
+ */
+class RunCache :
+    private LruCache< RunKey, CachedRun, RunKeyHash >
+{
+    private:
+        typedef LruCache< RunKey, CachedRun, RunKeyHash > Lru_t;
+
+        /// not copy-constructable
+        RunCache( const RunCache& );
+
+        /// not copy-assignable
+        RunCache& operator=( const RunCache& );
+
+    public:
+        /// hit / miss counters, misses are lookups which laid out the text
+        typedef Lru_t::Stats Stats;
+
+        /// create a cache which holds at most @p budget bytes
+        explicit RunCache( size_t budget = 4*1024*1024 );
+
+        /// return the laid out text, laying it out with @p layout on a miss
+        /**
+         *  @param[in]  layout      layout engine, its face at its active
+         *                          size is part of the key
+         *  @param[in]  utf8        the text
+         *  @param[in]  length      number of bytes of text
+         *  @param[in]  max_width   see TextLayout::layout()
+         *  @return the cached run, or NULL if reading advances failed
+         */
+        const GlyphRun* lookup( TextLayout& layout,
+                                const char* utf8,
+                                size_t      length,
+                                Pos         max_width = 0 );
+
+        /// lookup() of a zero terminated string
+        const GlyphRun* lookup( TextLayout& layout,
+                                const char* utf8,
+                                Pos         max_width = 0 );
+
+        /// same as lookup() but also returns the FreeType error code
+        RValuePair< const GlyphRun*, Error > lookup_e(
+                                TextLayout& layout,
+                                const char* utf8,
+                                size_t      length,
+                                Pos         max_width = 0 );
+
+        /// drop every run which was laid out with @p face
+        void purge( RefPtr<Face>& face );
+
+        using Lru_t::clear;
+        using Lru_t::set_budget;
+        using Lru_t::budget;
+        using Lru_t::bytes;
+        using Lru_t::size;
+        using Lru_t::stats;
+        using Lru_t::reset_stats;
+};
+
+} // namespace freetype
+
+#endif // RUNCACHE_H_
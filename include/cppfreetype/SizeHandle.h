@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/SizeHandle.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_SIZEHANDLE_H_
+#define CPPFREETYPE_SIZEHANDLE_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+
+namespace freetype {
+
+/// one of several sizes of a face, each with its own scaled metrics and
+/// hinting state
+/**
+ *  Setting the size of a face rescales it and, for hinted TrueType fonts,
+ *  runs the font's prep program again, so rendering a face at several
+ *  sizes in turn pays for that at every switch. A SizeHandle owns an extra
+ *  FT_Size of its face: set its size once, then activate() it, which only
+ *  points the face at it, whenever glyphs of that size are needed.
+ *
+ *  @code
+ *  SizeHandle sizes[3];
+ *  for( int i=0; i < 3; i++ )
+ *  {
+ *      sizes[i].create( face );
+ *      sizes[i].set_pixel_sizes( 0, 12 + 4*i );
+ *  }
+ *  ...
+ *  sizes[1].activate();
+ *  face->load_glyph( glyph, load::DEFAULT );
+ *  @endcode
+ *
+ *  The handle holds a reference to its face, so the face lives at least
+ *  as long as the handle. Caches keyed by the face's current size, like
+ *  GlyphCache, see the active size as usual.
+ */
+class SizeHandle
+{
+    private:
+        RefPtr<Face>    m_face;
+        FT_Size         m_size;     ///< NULL if empty
+
+        /// not copy-constructable
+        SizeHandle( const SizeHandle& );
+
+        /// not copy-assignable
+        SizeHandle& operator=( const SizeHandle& );
+
+    public:
+        /// an empty handle
+        SizeHandle();
+
+        /// releases the size
+        ~SizeHandle();
+
+        /// create a new size of @p face, releasing the one held before
+        /**
+         *  The face's active size is left unchanged.
+         *
+         *  @return FreeType error code, the handle is empty unless it is 0
+         */
+        Error create( RefPtr<Face>& face );
+
+        /// release the size and the reference to the face, if the size was
+        /// active FreeType activates another size of the face
+        void release();
+
+        /// make this the active size of the face
+        Error activate();
+
+        /// whether this is the active size of the face
+        bool is_active() const;
+
+        /// activate this size and set its nominal size in 26.6 points,
+        /// see FaceDelegate::set_char_size()
+        Error set_char_size( F26Dot6 char_width,
+                             F26Dot6 char_height,
+                             UInt    horz_resolution,
+                             UInt    vert_resolution );
+
+        /// activate this size and set its nominal size in pixels, see
+        /// FaceDelegate::set_pixel_sizes()
+        Error set_pixel_sizes( UInt pixel_width, UInt pixel_height );
+
+        /// the scaled metrics of this size, the handle must not be empty
+        const FT_Size_Metrics& metrics() const;
+
+        /// the face this size belongs to
+        RefPtr<Face>& face();
+
+        /// whether the handle holds a size
+        bool is_valid() const;
+};
+
+} // namespace freetype
+
+#endif // SIZEHANDLE_H_
@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/SlabAllocator.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_SLABALLOCATOR_H_
+#define CPPFREETYPE_SLABALLOCATOR_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/Memory.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// size-class slab allocator policy for FreeType memory managers
+/**
+ *  Small blocks (up to 4 KiB) are carved out of large chunks with a bump
+ *  pointer, and freed blocks go on a free list for their size class, so the
+ *  allocate/free pairs FreeType makes while loading, hinting and
+ *  rasterizing a glyph become pointer pushes and pops. Larger blocks go to
+ *  the C library.
+ *
+ *  A pure bump arena cannot back a FreeType library on its own, because
+ *  FreeType keeps some of the memory it allocates during a glyph load (the
+ *  slot's glyph loader and bitmap buffers) for the following loads. The free
+ *  lists make the allocator safe for such long-lived blocks, and reset()
+ *  rewinds the arena once a batch has given every block back, e.g. after
+ *  the batch's library has been destroyed.
+ *
+ *  Use it like this:
+ *  @code
+SlabAllocator slab;
+Memory        memory = Memory::create( &slab );
+{
+    RefPtr<Library> library = Library::create( memory );
+    library->add_default_modules();
+    // ... open faces and load the batch ...
+}
+slab.reset();
+memory.destroy();
+@endcode
+ *
+ *  @note   the allocator is not thread safe, give each thread's library
+ *          its own allocator
+ */
+class SlabAllocator
+{
+    public:
+        /// allocator call counters
+        struct Stats
+        {
+            ULong   alloc_calls;    ///< calls to alloc()
+            ULong   free_calls;     ///< calls to free()
+            ULong   realloc_calls;  ///< calls to realloc()
+            ULong   system_calls;   ///< calls made to the C library
+            ULong   live_blocks;    ///< blocks currently allocated
+            ULong   reserved_bytes; ///< bytes held in chunks
+
+            Stats();
+        };
+
+        /// number of small block size classes
+        static const UInt NUM_CLASSES = 16;
+
+        /// largest block served from a slab
+        static const UInt MAX_SMALL = 4096;
+
+    private:
+        /// a freed block, linked into the list for its size class
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        size_t              m_chunk_size;
+        std::vector<Byte*>  m_chunks;       ///< all chunks, in order
+        size_t              m_chunk;        ///< index of the current chunk
+        Byte*               m_cursor;       ///< next free byte of it
+        Byte*               m_end;          ///< end of it
+        FreeBlock*          m_free[NUM_CLASSES];
+        Byte                m_class[ MAX_SMALL/16 + 1 ];  ///< size to class
+        Stats               m_stats;
+
+        /// not copy-constructable
+        SlabAllocator( const SlabAllocator& );
+
+        /// not copy-assignable
+        SlabAllocator& operator=( const SlabAllocator& );
+
+        /// carve a new block of size class @p c out of the chunks
+        Byte* bump( UInt c );
+
+    public:
+        /// create an allocator which reserves memory @p chunk_size bytes at
+        /// a time
+        explicit SlabAllocator( size_t chunk_size = 64*1024 );
+
+        /// releases all chunks, every library using the allocator must be
+        /// destroyed first
+        ~SlabAllocator();
+
+        /// allocator policy interface, see MallocAllocator
+        void* alloc( long size );
+        void  free( void* block );
+        void* realloc( long cur_size, long new_size, void* block );
+
+        /// rewind the arena so the chunks are reused from the start
+        /**
+         *  @return false, and do nothing, if any block is still allocated
+         */
+        bool reset();
+
+        /// call counters
+        const Stats& stats() const;
+
+        /// zero the call counters, leaving the live and reserved counts
+        void reset_stats();
+
+        /// size in bytes of the blocks of size class @p c
+        static UInt class_size( UInt c );
+};
+
+} // namespace freetype
+
+#endif // SLABALLOCATOR_H_
@@ -0,0 +1,172 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   include/cppfreetype/TextLayout.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_TEXTLAYOUT_H_
+#define CPPFREETYPE_TEXTLAYOUT_H_
+
+#include <cppfreetype/types.h>
+#include <cppfreetype/RefPtr.h>
+#include <cppfreetype/Face.h>
+#include <cppfreetype/AdvanceTable.h>
+#include <cppfreetype/CharmapIndex.h>
+#include <cppfreetype/KerningTable.h>
+
+#include <vector>
+
+namespace freetype {
+
+/// decode the UTF-8 code point starting at @p text[i] and advance @p i
+/// past it, an invalid or truncated sequence decodes as U+FFFD and @p i
+/// resumes at the offending byte
+UInt32 decode_utf8( const Byte* text, size_t length, size_t& i );
+
+/// glyphs positioned by TextLayout, in structure-of-arrays form
+/**
+ *  Positions are the pen position on the baseline of each glyph in 26.6
+ *  pixels. The origin is the top left corner of the laid out block and y
+ *  grows downward, so the baseline of line n is at
+ *  ascender + n*line_height.
+ */
+struct GlyphRun
+{
+    std::vector<UInt>   glyphs;     ///< glyph index of each glyph
+    std::vector<Pos>    x;          ///< pen x of each glyph
+    std::vector<Pos>    y;          ///< baseline y of each glyph
+    std::vector<UInt>   clusters;   ///< byte offset in the text of the
+                                    ///  character of each glyph
+    std::vector<UInt>   line_ends;  ///< one past the last glyph of each line
+
+    Pos     width;          ///< widest line, without trailing spaces
+    Pos     height;         ///< from the top of the first line to the
+                            ///  bottom of the last
+    Pos     ascender;       ///< scaled ascender
+    Pos     descender;      ///< scaled descender, usually negative
+    Pos     line_height;    ///< distance between baselines
+
+    GlyphRun();
+
+    /// drop all glyphs, keeping the storage
+    void clear();
+
+    /// number of glyphs
+    size_t size() const;
+
+    /// number of lines
+    size_t n_lines() const;
+
+    /// the layout box, ( 0, 0 ) to ( width, height ), y growing downward
+    FT_BBox bbox() const;
+
+    /// approximate heap memory held by the run
+    size_t bytes() const;
+};
+
+/// lays out UTF-8 text with one face into lines of positioned glyphs
+/**
+ *  Character codes are mapped with a CharmapIndex, advances come from an
+ *  AdvanceTable and kerning from a KerningTable, so laying out text does
+ *  not load any glyph, and laying out into a reused GlyphRun does not
+ *  allocate once the run has grown to the size of the text.
+ *
+ *  Lines are broken at the last space which keeps the line within the
+ *  maximum width, or before the glyph which overflows if the line has no
+ *  space, and at every line feed. Line heights come from the face's
+ *  ascender, descender and height scaled to its active size.
+ *
+ *  The layout follows the active size of the face, but rebuild() it if the
+ *  face's charmap is changed. There is no shaping, bidi or script specific
+ *  line breaking.
+ */
+class TextLayout
+{
+    private:
+        RefPtr<Face>    m_face;
+        CharmapIndex    m_charmap;
+        AdvanceTable    m_advances;
+        KerningTable    m_kerning;
+        kerning_mode::KerningMode m_kerning_mode;
+        bool            m_kern_table;   ///< m_kerning has the pairs
+        bool            m_kern_query;   ///< ask FT_Get_Kerning instead
+        Fixed           m_x_scale;      ///< size m_kerning is scaled for
+
+        /// not copy-constructable
+        TextLayout( const TextLayout& );
+
+        /// not copy-assignable
+        TextLayout& operator=( const TextLayout& );
+
+        /// kerning between two glyphs at the active size
+        Pos kerning( UInt left, UInt right );
+
+    public:
+        /// a layout engine for @p face
+        /**
+         *  @param[in]  face            the face, its active size is used
+         *  @param[in]  load_flags      flags the advances are read with
+         *  @param[in]  mode            how kerning is scaled, the default
+         *                              keeps fractional kerning to go with
+         *                              unhinted advances
+         */
+        explicit TextLayout( RefPtr<Face>& face,
+                             Int32 load_flags = FT_LOAD_NO_HINTING,
+                             kerning_mode::KerningMode mode
+                                                = kerning_mode::UNFITTED );
+
+        /// lay out @p length bytes of UTF-8 text into @p run
+        /**
+         *  @param[in]  utf8        the text, invalid sequences are laid
+         *                          out as U+FFFD
+         *  @param[in]  length      number of bytes of text
+         *  @param[out] run         receives the glyphs, replacing its
+         *                          contents
+         *  @param[in]  max_width   maximum line width in 26.6 pixels, 0
+         *                          to break only at line feeds
+         *
+         *  @return the first error met reading advances for this text,
+         *          the layout is complete in any case
+         */
+        Error layout( const char* utf8, size_t length, GlyphRun& run,
+                      Pos max_width = 0 );
+
+        /// lay out a zero terminated UTF-8 string
+        Error layout( const char* utf8, GlyphRun& run, Pos max_width = 0 );
+
+        /// re-read the charmap and kerning pairs of the face
+        void rebuild();
+
+        /// the face
+        RefPtr<Face> face();
+
+        /// flags the advances are read with
+        Int32 load_flags() const;
+
+        /// how kerning is scaled
+        kerning_mode::KerningMode mode() const;
+};
+
+} // namespace freetype
+
+#endif // TEXTLAYOUT_H_
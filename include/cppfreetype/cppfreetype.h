@@ -32,16 +32,47 @@
 #include <cppfreetype/CPtr.h>
 
 #include <cppfreetype/types.h>
+#include <cppfreetype/AdvanceTable.h>
+#include <cppfreetype/BitmapView.h>
+#include <cppfreetype/CharmapIndex.h>
+#include <cppfreetype/CompactOutline.h>
+#include <cppfreetype/Coverage.h>
+#include <cppfreetype/CoverageFilter.h>
+#include <cppfreetype/Decompose.h>
 #include <cppfreetype/Face.h>
+#include <cppfreetype/FallbackChain.h>
+#include <cppfreetype/Flattener.h>
+#include <cppfreetype/FontIndex.h>
+#include <cppfreetype/FontWatcher.h>
+#include <cppfreetype/Glyph.h>
+#include <cppfreetype/GlyphAtlas.h>
+#include <cppfreetype/GlyphBatch.h>
+#include <cppfreetype/GlyphCache.h>
+#include <cppfreetype/GlyphCacheFile.h>
 #include <cppfreetype/GlyphSlot.h>
+#include <cppfreetype/KerningTable.h>
 #include <cppfreetype/Library.h>
+#include <cppfreetype/LibraryPool.h>
+#include <cppfreetype/LruCache.h>
+#include <cppfreetype/MappedFile.h>
+#include <cppfreetype/MemoryProfiler.h>
 #include <cppfreetype/Outline.h>
+#include <cppfreetype/Prewarm.h>
+#include <cppfreetype/RunCache.h>
+#include <cppfreetype/SizeHandle.h>
+#include <cppfreetype/SlabAllocator.h>
+#include <cppfreetype/TextLayout.h>
 #include <cppfreetype/Untag.h>
 
 
 /// root namespace for freetype
 namespace freetype
 {
+    /// FreeType version the library was built against
+    extern const unsigned int MAJOR;
+    extern const unsigned int MINOR;
+    extern const unsigned int PATCH;
+
     /// Initialize a new FreeType library object. The set of modules that are
     /// registered by this function is determined at build time.
     /**
@@ -178,6 +178,12 @@ namespace pixelmode
                 ///   glyph images used for display on rotated LCD
                 ///   displays; the bitmap is three times taller than the
                 ///   original glyph image. See also FT_RENDER_MODE_LCD_V.
+        BGRA,   ///<  An image with four 8-bit channels per pixel,
+                ///   representing a color image (such as emoticons) with
+                ///   alpha channel. For each pixel, the format is BGRA,
+                ///   which means, the blue channel comes first in memory.
+                ///   The color channels are pre-multiplied and in the sRGB
+                ///   colorspace.
         MAX     ///<  used for iterating over enum
     };
 
@@ -0,0 +1,219 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/AdvanceTable.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/AdvanceTable.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_ADVANCES_H
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace freetype {
+
+const UInt AdvanceTable::PAGE_BITS;
+const UInt AdvanceTable::PAGE_SIZE;
+
+void AdvanceTable::sync()
+{
+    FT_Size size = m_face.subvert()->size;
+    if( !size )
+        return;
+
+    if( size->metrics.x_scale != m_x_scale
+            || size->metrics.y_scale != m_y_scale )
+    {
+        invalidate();
+        m_x_scale = size->metrics.x_scale;
+        m_y_scale = size->metrics.y_scale;
+    }
+}
+
+void AdvanceTable::fill_page( UInt page )
+{
+    UInt first = page << PAGE_BITS;
+    UInt count = std::min( PAGE_SIZE, m_num_glyphs - first );
+
+    // FT_Get_Advances writes FT_Fixed values
+    Fixed fixed[PAGE_SIZE];
+    Error err = FT_Get_Advances( m_face.subvert(), first, count,
+                                 m_load_flags | FT_LOAD_ADVANCE_ONLY, fixed );
+
+    Int32* out = &m_advances[first];
+    if( err )
+    {
+        // the page reads as zero and is tried again on the next access, so
+        // every call which needs it sees the error
+        if( !m_error )
+            m_error = err;
+        std::fill( out, out + count, 0 );
+        return;
+    }
+
+    if( m_load_flags & FT_LOAD_NO_SCALE )
+        std::copy( fixed, fixed + count, out );
+    else
+    {
+        // 16.16 to 26.6
+        for( UInt i=0; i < count; i++ )
+            out[i] = ( fixed[i] + 512 ) >> 10;
+    }
+
+    m_loaded[page] = 1;
+    ++m_pages_loaded;
+}
+
+AdvanceTable::AdvanceTable( RefPtr<Face>& face, Int32 load_flags ):
+    m_face(face),
+    m_load_flags(load_flags),
+    m_num_glyphs( face->num_glyphs() ),
+    m_pages_loaded(0),
+    m_x_scale(0),
+    m_y_scale(0),
+    m_error(0)
+{
+    m_advances.assign( m_num_glyphs, 0 );
+    m_loaded.assign( ( m_num_glyphs + PAGE_SIZE - 1 ) >> PAGE_BITS, 0 );
+    sync();
+}
+
+Int32 AdvanceTable::advance( UInt glyph_index )
+{
+    if( glyph_index >= m_num_glyphs )
+        return 0;
+
+    sync();
+    UInt page = glyph_index >> PAGE_BITS;
+    if( !m_loaded[page] )
+        fill_page( page );
+    return m_advances[glyph_index];
+}
+
+Long AdvanceTable::measure( const UInt* glyph_indices, size_t count )
+{
+    sync();
+
+    // make sure every page we are about to read is there
+    if( m_pages_loaded < m_loaded.size() )
+    {
+        for( size_t i=0; i < count; i++ )
+        {
+            UInt glyph = glyph_indices[i];
+            if( glyph < m_num_glyphs && !m_loaded[ glyph >> PAGE_BITS ] )
+                fill_page( glyph >> PAGE_BITS );
+        }
+    }
+
+    Long   total    = 0;
+    size_t i        = 0;
+    const Int32* advances = m_advances.empty() ? 0 : &m_advances[0];
+
+#if defined(__AVX2__)
+    if( advances )
+    {
+        const __m256i limit = _mm256_set1_epi32( m_num_glyphs );
+        const __m256i zero  = _mm256_setzero_si256();
+
+        while( i + 8 <= count )
+        {
+            // 32 bit lanes can not overflow within a block of 8192 glyphs
+            size_t  block = std::min( count - i, (size_t)8192 ) & ~(size_t)7;
+            __m256i sum   = zero;
+            for( size_t end = i + block; i < end; i += 8 )
+            {
+                __m256i glyph = _mm256_loadu_si256(
+                                    (const __m256i*)( glyph_indices + i ) );
+
+                // unsigned compare, indices which look negative are out of
+                // range as well
+                __m256i valid = _mm256_andnot_si256(
+                                    _mm256_cmpgt_epi32( zero, glyph ),
+                                    _mm256_cmpgt_epi32( limit, glyph ) );
+                sum = _mm256_add_epi32( sum,
+                        _mm256_mask_i32gather_epi32( zero, advances, glyph,
+                                                     valid, 4 ) );
+            }
+
+            Int32 lanes[8];
+            _mm256_storeu_si256( (__m256i*)lanes, sum );
+            for( UInt k=0; k < 8; k++ )
+                total += lanes[k];
+        }
+    }
+#endif
+
+    for( ; i < count; i++ )
+    {
+        UInt glyph = glyph_indices[i];
+        if( glyph < m_num_glyphs )
+            total += advances[glyph];
+    }
+
+    return total;
+}
+
+void AdvanceTable::fill()
+{
+    sync();
+    for( UInt page=0; page < m_loaded.size(); page++ )
+    {
+        if( !m_loaded[page] )
+            fill_page( page );
+    }
+}
+
+void AdvanceTable::invalidate()
+{
+    std::fill( m_loaded.begin(), m_loaded.end(), 0 );
+    m_pages_loaded = 0;
+    m_error        = 0;
+}
+
+Int32 AdvanceTable::load_flags() const
+{
+    return m_load_flags;
+}
+
+UInt AdvanceTable::pages_loaded() const
+{
+    return m_pages_loaded;
+}
+
+Error AdvanceTable::error() const
+{
+    return m_error;
+}
+
+void AdvanceTable::clear_error()
+{
+    m_error = 0;
+}
+
+} // namespace freetype
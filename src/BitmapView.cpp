@@ -0,0 +1,125 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/BitmapView.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/BitmapView.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace freetype {
+
+namespace {
+
+/// write the coverage of pixels @p first to @p first + @p count of the row
+/// @p src to @p dst
+void expand_row( const BitmapView& view, const Byte* src,
+                 Int first, Int count, Byte* dst )
+{
+    switch( view.pixel_mode )
+    {
+        case pixelmode::MONO:
+            for( Int i=first; i < first + count; i++ )
+                *dst++ = ( src[i >> 3] & (0x80 >> (i & 7)) ) ? 0xFF : 0;
+            break;
+
+        case pixelmode::GRAY2:
+            for( Int i=first; i < first + count; i++ )
+                *dst++ = ( ( src[i >> 2] >> (6 - 2*(i & 3)) ) & 0x03 ) * 0x55;
+            break;
+
+        case pixelmode::GRAY4:
+            for( Int i=first; i < first + count; i++ )
+                *dst++ = ( ( src[i >> 1] >> (4 - 4*(i & 1)) ) & 0x0F ) * 0x11;
+            break;
+
+        case pixelmode::GRAY:
+            if( view.num_grays > 1 && view.num_grays != 256 )
+            {
+                for( Int i=first; i < first + count; i++ )
+                    *dst++ = src[i] * 255 / ( view.num_grays - 1 );
+                break;
+            }
+            std::memcpy( dst, src + first, count );
+            break;
+
+        case pixelmode::BGRA:
+            for( Int i=first; i < first + count; i++ )
+                *dst++ = src[4*i + 3];
+            break;
+
+        default:
+            std::memcpy( dst, src + first, count );
+            break;
+    }
+}
+
+}
+
+BitmapView::BitmapView():
+    buffer(0),
+    width(0),
+    rows(0),
+    pitch(0),
+    pixel_mode(pixelmode::NONE),
+    num_grays(0)
+{}
+
+BitmapView::BitmapView( const FT_Bitmap& bitmap ):
+    buffer(bitmap.buffer),
+    width(bitmap.width),
+    rows(bitmap.rows),
+    pitch(bitmap.pitch),
+    pixel_mode(bitmap.pixel_mode),
+    num_grays(bitmap.num_grays)
+{}
+
+Byte BitmapView::coverage( Int i, Int j ) const
+{
+    Byte value;
+    expand_row( *this, row(j), i, 1, &value );
+    return value;
+}
+
+void BitmapView::blit_to( Byte* dst, Int dst_pitch, Int dst_width,
+                          Int dst_rows, Int x, Int y ) const
+{
+    if( empty() )
+        return;
+
+    // clip to the image
+    Int i0 = std::max( 0, -x );
+    Int j0 = std::max( 0, -y );
+    Int i1 = std::min( width, dst_width - x );
+    Int j1 = std::min( rows,  dst_rows  - y );
+    if( i0 >= i1 || j0 >= j1 )
+        return;
+
+    for( Int j=j0; j < j1; j++ )
+        expand_row( *this, row(j), i0, i1 - i0,
+                    dst + (ptrdiff_t)( y + j ) * dst_pitch + x + i0 );
+}
+
+} // namespace freetype
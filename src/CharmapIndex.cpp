@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/CharmapIndex.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/CharmapIndex.h>
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace freetype {
+
+const UInt32 CharmapIndex::LIMIT;
+const UInt32 CharmapIndex::PAGE_BITS;
+const UInt32 CharmapIndex::PAGE_SIZE;
+const UInt32 CharmapIndex::NUM_PAGES;
+
+CharmapIndex::CharmapIndex()
+{
+    clear();
+}
+
+void CharmapIndex::clear()
+{
+    std::memset( m_latin1, 0, sizeof(m_latin1) );
+    std::memset( m_top,    0, sizeof(m_top) );
+    m_glyphs.assign( PAGE_SIZE, 0 );
+    m_size = 0;
+}
+
+void CharmapIndex::build( RefPtr<Face>& face )
+{
+    clear();
+
+    UInt  glyph = 0;
+    ULong code  = face->get_first_char( glyph );
+    while( glyph != 0 )
+    {
+        if( code < 256 )
+            m_latin1[code] = glyph;
+
+        if( code < LIMIT )
+        {
+            UInt32 page = code >> PAGE_BITS;
+            if( !m_top[page] )
+            {
+                m_top[page] = m_glyphs.size();
+                m_glyphs.resize( m_glyphs.size() + PAGE_SIZE, 0 );
+            }
+            m_glyphs[ m_top[page] + ( code & (PAGE_SIZE-1) ) ] = glyph;
+            ++m_size;
+        }
+
+        code = face->get_next_char( code, glyph );
+    }
+}
+
+void CharmapIndex::lookup( const UInt32* char_codes, size_t count,
+                           UInt* glyph_indices ) const
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i limit = _mm256_set1_epi32( LIMIT );
+    const __m256i low   = _mm256_set1_epi32( PAGE_SIZE - 1 );
+    const __m256i zero  = _mm256_setzero_si256();
+    const int*    top   = (const int*)m_top;
+    const int*    pages = (const int*)&m_glyphs[0];
+
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m256i code = _mm256_loadu_si256( (const __m256i*)(char_codes + i) );
+
+        // codes are unsigned, out of range ones (including those which
+        // look negative) are masked out of both gathers
+        __m256i valid = _mm256_andnot_si256(
+                            _mm256_cmpgt_epi32( zero, code ),
+                            _mm256_cmpgt_epi32( limit, code ) );
+        __m256i page  = _mm256_srli_epi32( code, PAGE_BITS );
+        __m256i base  = _mm256_mask_i32gather_epi32( zero, top, page,
+                                                     valid, 4 );
+        __m256i index = _mm256_add_epi32( base, _mm256_and_si256(code,low) );
+        __m256i glyph = _mm256_mask_i32gather_epi32( zero, pages, index,
+                                                     valid, 4 );
+        _mm256_storeu_si256( (__m256i*)(glyph_indices + i), glyph );
+    }
+#endif
+
+    for( ; i < count; i++ )
+        glyph_indices[i] = lookup( char_codes[i] );
+}
+
+size_t CharmapIndex::size() const
+{
+    return m_size;
+}
+
+size_t CharmapIndex::num_pages() const
+{
+    return m_glyphs.size() / PAGE_SIZE - 1;
+}
+
+size_t CharmapIndex::bytes() const
+{
+    return sizeof(*this) + m_glyphs.capacity() * sizeof(UInt);
+}
+
+} // namespace freetype
@@ -0,0 +1,166 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/CompactOutline.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/CompactOutline.h>
+
+#include <algorithm>
+
+namespace freetype {
+
+CompactOutline::CompactOutline():
+    flags(0),
+    n_on(0),
+    n_conic(0),
+    n_cubic(0)
+{}
+
+void CompactOutline::assign( const OutlineView& view )
+{
+    Int n = view.n_points;
+
+    x.resize(n);
+    y.resize(n);
+    tags.resize(n);
+    contour_ends.resize( view.n_contours );
+    flags = view.flags;
+
+    // de-interleave the points
+    const FT_Vector* points = view.points;
+    Pos* px = x.data();
+    Pos* py = y.data();
+    for( Int i=0; i < n; i++ )
+    {
+        px[i] = points[i].x;
+        py[i] = points[i].y;
+    }
+
+    for( Int c=0; c < view.n_contours; c++ )
+        contour_ends[c] = view.contours[c] + 1;
+
+    classify( view.tags, n, tags.data() );
+
+    // count the classes, the tags are exactly 0, 1 or 2 now
+    Int on = 0;
+    Int cubic = 0;
+    const Byte* t = tags.data();
+    for( Int i=0; i < n; i++ )
+    {
+        on    += t[i] & 0x01;
+        cubic += t[i] >> 1;
+    }
+
+    n_on    = on;
+    n_cubic = cubic;
+    n_conic = n - on - cubic;
+}
+
+void CompactOutline::assign( RefPtr<Outline> outline )
+{
+    assign( outline->view() );
+}
+
+void CompactOutline::clear()
+{
+    x.clear();
+    y.clear();
+    tags.clear();
+    contour_ends.clear();
+    flags   = 0;
+    n_on    = 0;
+    n_conic = 0;
+    n_cubic = 0;
+}
+
+Int CompactOutline::n_points() const
+{
+    return x.size();
+}
+
+Int CompactOutline::n_contours() const
+{
+    return contour_ends.size();
+}
+
+Int CompactOutline::contour_begin( Int c ) const
+{
+    return c > 0 ? contour_ends[c-1] : 0;
+}
+
+Int CompactOutline::contour_end( Int c ) const
+{
+    return contour_ends[c];
+}
+
+FT_BBox CompactOutline::cbox() const
+{
+    FT_BBox box = { 0, 0, 0, 0 };
+    Int n = x.size();
+    if( n == 0 )
+        return box;
+
+    const Pos* px = x.data();
+    const Pos* py = y.data();
+    Pos xmin = px[0], xmax = px[0];
+    Pos ymin = py[0], ymax = py[0];
+    for( Int i=1; i < n; i++ )
+    {
+        xmin = std::min( xmin, px[i] );
+        xmax = std::max( xmax, px[i] );
+        ymin = std::min( ymin, py[i] );
+        ymax = std::max( ymax, py[i] );
+    }
+
+    box.xMin = xmin;
+    box.yMin = ymin;
+    box.xMax = xmax;
+    box.yMax = ymax;
+    return box;
+}
+
+void CompactOutline::classify( const char* tags, Int n, Byte* out )
+{
+    // bit 0 set is on-curve whatever bit 1 says, otherwise bit 1 selects
+    // cubic (2) over conic (0)
+    for( Int i=0; i < n; i++ )
+    {
+        Byte t   = tags[i] & 0x03;
+        Byte on  = t & 0x01;
+        out[i]   = on | ( t & (Byte)~(on << 1) );
+    }
+}
+
+Int CompactOutline::on_mask( const Byte* tags, Int n, Byte* out )
+{
+    Int count = 0;
+    for( Int i=0; i < n; i++ )
+    {
+        out[i]  = tags[i] & 0x01;
+        count  += out[i];
+    }
+    return count;
+}
+
+} // namespace freetype
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/Coverage.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/Coverage.h>
+
+#include <algorithm>
+
+namespace freetype {
+
+const UInt Coverage::PAGE_BITS;
+const UInt Coverage::PAGE_SIZE;
+const UInt Coverage::PAGE_WORDS;
+
+namespace {
+
+inline UInt popcount( Coverage::Word_t word )
+{
+    return __builtin_popcountll( word );
+}
+
+}
+
+Coverage::Coverage():
+    m_count(0)
+{}
+
+const Coverage::Word_t* Coverage::mask( UInt32 page ) const
+{
+    std::vector<UInt32>::const_iterator iter =
+        std::lower_bound( m_pages.begin(), m_pages.end(), page );
+    if( iter == m_pages.end() || *iter != page )
+        return 0;
+    return &m_bits[ ( iter - m_pages.begin() ) * PAGE_WORDS ];
+}
+
+void Coverage::build( RefPtr<Face>& face )
+{
+    clear();
+
+    UInt  glyph;
+    ULong charcode = face->get_first_char( glyph );
+    while( glyph )
+    {
+        add( charcode );
+        charcode = face->get_next_char( charcode, glyph );
+    }
+}
+
+void Coverage::add( ULong charcode )
+{
+    UInt32 page = charcode >> PAGE_BITS;
+    UInt   bit  = charcode & ( PAGE_SIZE - 1 );
+
+    size_t index;
+    if( !m_pages.empty() && m_pages.back() == page )
+        index = m_pages.size() - 1;
+    else
+    {
+        std::vector<UInt32>::iterator iter =
+            std::lower_bound( m_pages.begin(), m_pages.end(), page );
+        index = iter - m_pages.begin();
+        if( iter == m_pages.end() || *iter != page )
+        {
+            m_pages.insert( iter, page );
+            m_bits.insert( m_bits.begin() + index * PAGE_WORDS,
+                           PAGE_WORDS, 0 );
+        }
+    }
+
+    Word_t& word = m_bits[ index * PAGE_WORDS + bit / 64 ];
+    Word_t  flag = (Word_t)1 << ( bit % 64 );
+    if( !( word & flag ) )
+    {
+        word |= flag;
+        ++m_count;
+    }
+}
+
+void Coverage::assign( const UInt32* pages, const Word_t* bits,
+                       size_t n_pages )
+{
+    m_pages.assign( pages, pages + n_pages );
+    m_bits.assign( bits, bits + n_pages * PAGE_WORDS );
+
+    m_count = 0;
+    for( size_t i=0; i < m_bits.size(); i++ )
+        m_count += popcount( m_bits[i] );
+}
+
+bool Coverage::contains( ULong charcode ) const
+{
+    const Word_t* words = mask( charcode >> PAGE_BITS );
+    if( !words )
+        return false;
+
+    UInt bit = charcode & ( PAGE_SIZE - 1 );
+    return ( words[ bit / 64 ] >> ( bit % 64 ) ) & 1;
+}
+
+void Coverage::clear()
+{
+    m_pages.clear();
+    m_bits.clear();
+    m_count = 0;
+}
+
+size_t Coverage::count() const
+{
+    return m_count;
+}
+
+size_t Coverage::num_pages() const
+{
+    return m_pages.size();
+}
+
+const UInt32* Coverage::pages() const
+{
+    return m_pages.empty() ? 0 : &m_pages[0];
+}
+
+const Coverage::Word_t* Coverage::bits() const
+{
+    return m_bits.empty() ? 0 : &m_bits[0];
+}
+
+size_t Coverage::bytes() const
+{
+    return m_pages.capacity() * sizeof(UInt32)
+         + m_bits.capacity()  * sizeof(Word_t);
+}
+
+} // namespace freetype
@@ -0,0 +1,168 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/CoverageFilter.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/CoverageFilter.h>
+
+namespace freetype {
+
+const UInt CoverageFilter::NUM_HASHES;
+
+namespace {
+
+/// the finalizer of the face a filter is attached to
+void free_filter( void* object )
+{
+    FT_Face face = (FT_Face)object;
+    delete (CoverageFilter*)face->generic.data;
+    face->generic.data      = 0;
+    face->generic.finalizer = 0;
+}
+
+}
+
+CoverageFilter::CoverageFilter()
+{
+    reset( 0, 0 );
+}
+
+void CoverageFilter::reset( size_t count, UInt bits_per_code )
+{
+    size_t n_words = 1;
+    while( n_words * 64 < count * bits_per_code )
+        n_words *= 2;
+
+    m_words.assign( n_words, 0 );
+    m_count = 0;
+}
+
+void CoverageFilter::add( ULong char_code )
+{
+    Word_t h = hash( char_code );
+    m_words[ word(h) ] |= mask( h );
+    ++m_count;
+}
+
+void CoverageFilter::build( RefPtr<Face>& face, UInt bits_per_code )
+{
+    // count first so the filter is sized once
+    size_t count = 0;
+    UInt   glyph = 0;
+    ULong  code  = face->get_first_char( glyph );
+    while( glyph != 0 )
+    {
+        ++count;
+        code = face->get_next_char( code, glyph );
+    }
+
+    reset( count, bits_per_code );
+
+    code = face->get_first_char( glyph );
+    while( glyph != 0 )
+    {
+        add( code );
+        code = face->get_next_char( code, glyph );
+    }
+}
+
+void CoverageFilter::build( const Coverage& coverage, UInt bits_per_code )
+{
+    reset( coverage.count(), bits_per_code );
+
+    const UInt32*           pages = coverage.pages();
+    const Coverage::Word_t* bits  = coverage.bits();
+    for( size_t p=0; p < coverage.num_pages(); p++ )
+    {
+        for( UInt w=0; w < Coverage::PAGE_WORDS; w++ )
+        {
+            Coverage::Word_t set = bits[ p * Coverage::PAGE_WORDS + w ];
+            while( set )
+            {
+                UInt bit = __builtin_ctzll( set );
+                set &= set - 1;
+                add( ( (ULong)pages[p] << Coverage::PAGE_BITS )
+                     + 64*w + bit );
+            }
+        }
+    }
+}
+
+void CoverageFilter::assign( const Word_t* words, size_t n_words,
+                             size_t count )
+{
+    m_words.assign( words, words + n_words );
+    if( m_words.empty() )
+        m_words.push_back( 0 );
+    m_count = count;
+}
+
+size_t CoverageFilter::count() const
+{
+    return m_count;
+}
+
+size_t CoverageFilter::num_words() const
+{
+    return m_words.size();
+}
+
+const CoverageFilter::Word_t* CoverageFilter::words() const
+{
+    return &m_words[0];
+}
+
+size_t CoverageFilter::bytes() const
+{
+    return m_words.capacity() * sizeof(Word_t);
+}
+
+Error CoverageFilter::attach( RefPtr<Face>& face ) const
+{
+    // the generic field belongs to whoever set it first
+    FT_Face ptr = face.subvert();
+    if( ( ptr->generic.data || ptr->generic.finalizer )
+            && ptr->generic.finalizer != free_filter )
+        return FT_Err_Invalid_Argument;
+
+    detach( ptr );
+    ptr->generic.data      = new CoverageFilter( *this );
+    ptr->generic.finalizer = free_filter;
+    return 0;
+}
+
+void CoverageFilter::detach( FT_Face face )
+{
+    if( attached( face ) )
+        free_filter( face );
+}
+
+const CoverageFilter* CoverageFilter::attached( FT_Face face )
+{
+    if( face->generic.finalizer != free_filter )
+        return 0;
+    return (const CoverageFilter*)face->generic.data;
+}
+
+} // namespace freetype
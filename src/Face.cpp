@@ -25,6 +25,8 @@
  */
 
 #include <cppfreetype/Face.h>
+#include <cppfreetype/CoverageFilter.h>
+#include <cppfreetype/GlyphBatch.h>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -321,6 +323,14 @@ Error FaceDelegate::load_char(ULong char_code, Int32 load_flags)
     return FT_Load_Char( m_ptr, char_code, load_flags );
 }
 
+Error FaceDelegate::load_glyphs( const UInt*   glyph_indices,
+                                 size_t        count,
+                                 Int32         load_flags,
+                                 GlyphBatch&   batch )
+{
+    return batch.load( m_ptr, glyph_indices, count, load_flags );
+}
+
 Error FaceDelegate::get_glyph_name(
                         UInt      glyph_index,
                         Pointer   buffer,
@@ -336,16 +346,22 @@ const char* FaceDelegate::get_postscript_name()
 
 Error FaceDelegate::select_charmap( Encoding encoding )
 {
+    // a filter describes the charmap it was built from
+    CoverageFilter::detach( m_ptr );
     return FT_Select_Charmap( m_ptr, (FT_Encoding)encoding );
 }
 
 Error FaceDelegate::set_charmap( UInt id )
 {
+    CoverageFilter::detach( m_ptr );
     return FT_Set_Charmap(m_ptr, m_ptr->charmaps[id] );
 }
 
 UInt FaceDelegate::get_char_index( ULong charcode )
 {
+    const CoverageFilter* filter = CoverageFilter::attached( m_ptr );
+    if( filter && !filter->may_contain( charcode ) )
+        return 0;
     return FT_Get_Char_Index( m_ptr, charcode );
 }
 
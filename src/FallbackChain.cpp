@@ -0,0 +1,187 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/FallbackChain.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/FallbackChain.h>
+#include <cppfreetype/TextLayout.h>
+
+#include <cstring>
+
+namespace freetype {
+
+const UInt32 FallbackChain::LIMIT;
+const UInt32 FallbackChain::PAGE_BITS;
+const UInt32 FallbackChain::PAGE_SIZE;
+const UInt32 FallbackChain::NUM_PAGES;
+const UInt32 FallbackChain::GLYPH_BITS;
+const UInt32 FallbackChain::GLYPH_MASK;
+const UInt32 FallbackChain::MAX_FACES;
+
+namespace {
+
+/// whether @p c belongs with the characters around it rather than to a
+/// script of its own
+bool is_neutral( UInt32 c )
+{
+    return c == ' ' || c == '\t' || c == 0xA0 || c == 0x3000
+        || ( c >= 0x0300 && c <= 0x036F )      // combining diacriticals
+        || ( c >= 0x1AB0 && c <= 0x1AFF )
+        || ( c >= 0x1DC0 && c <= 0x1DFF )
+        || ( c >= 0x20D0 && c <= 0x20FF )
+        || ( c >= 0xFE20 && c <= 0xFE2F )
+        || ( c >= 0x200C && c <= 0x200D )      // joiners
+        || ( c >= 0xFE00 && c <= 0xFE0F )      // variation selectors
+        || ( c >= 0xE0100 && c <= 0xE01EF );
+}
+
+}
+
+FallbackChain::FallbackChain()
+{
+    clear();
+}
+
+void FallbackChain::clear()
+{
+    m_faces.clear();
+    m_coverage.clear();
+    std::memset( m_top, 0, sizeof(m_top) );
+    m_entries.assign( PAGE_SIZE, 0 );
+    m_size = 0;
+}
+
+Error FallbackChain::add( RefPtr<Face>& face )
+{
+    if( !face || m_faces.size() >= MAX_FACES )
+        return FT_Err_Invalid_Argument;
+
+    UInt32 index = m_faces.size();
+    m_faces.push_back( face );
+    m_coverage.push_back( Coverage() );
+
+    // one walk of the charmap fills both the coverage and the page table,
+    // the same codes Coverage::build() would find
+    Coverage& coverage = m_coverage.back();
+    UInt      glyph    = 0;
+    ULong     code     = face->get_first_char( glyph );
+    while( glyph != 0 )
+    {
+        coverage.add( code );
+        if( code < LIMIT && glyph <= GLYPH_MASK )
+        {
+            UInt32 page = code >> PAGE_BITS;
+            if( !m_top[page] )
+            {
+                m_top[page] = m_entries.size();
+                m_entries.resize( m_entries.size() + PAGE_SIZE, 0 );
+            }
+
+            UInt32& entry = m_entries[ m_top[page]
+                                       + ( code & (PAGE_SIZE-1) ) ];
+            if( !entry )
+            {
+                entry = ( index << GLYPH_BITS ) | glyph;
+                ++m_size;
+            }
+        }
+
+        code = face->get_next_char( code, glyph );
+    }
+
+    return 0;
+}
+
+bool FallbackChain::resolve( ULong char_code, UInt& face, UInt& glyph ) const
+{
+    UInt32 entry = lookup( char_code );
+    face  = face_of( entry );
+    glyph = glyph_of( entry );
+    return entry != 0;
+}
+
+void FallbackChain::segment( const char* utf8, size_t length,
+                             std::vector<FallbackRun>& runs ) const
+{
+    const Byte* text  = (const Byte*)utf8;
+    size_t      first = runs.size();
+
+    for( size_t i=0; i < length; )
+    {
+        size_t begin = i;
+        UInt32 c     = decode_utf8( text, length, i );
+        UInt32 entry = lookup( c );
+
+        if( runs.size() > first )
+        {
+            FallbackRun& run = runs.back();
+            if( run.face == face_of(entry)
+                    || !entry
+                    || ( is_neutral(c)
+                            && m_coverage[run.face].contains(c) ) )
+            {
+                run.end = i;
+                continue;
+            }
+        }
+
+        FallbackRun run;
+        run.face  = face_of( entry );
+        run.begin = begin;
+        run.end   = i;
+        runs.push_back( run );
+    }
+}
+
+size_t FallbackChain::num_faces() const
+{
+    return m_faces.size();
+}
+
+RefPtr<Face>& FallbackChain::face( size_t i )
+{
+    return m_faces[i];
+}
+
+size_t FallbackChain::size() const
+{
+    return m_size;
+}
+
+size_t FallbackChain::num_pages() const
+{
+    return m_entries.size() / PAGE_SIZE - 1;
+}
+
+size_t FallbackChain::bytes() const
+{
+    size_t bytes = sizeof(*this) + m_entries.capacity() * sizeof(UInt32)
+                 + m_faces.capacity() * sizeof(RefPtr<Face>)
+                 + m_coverage.capacity() * sizeof(Coverage);
+    for( size_t i=0; i < m_coverage.size(); i++ )
+        bytes += m_coverage[i].bytes();
+    return bytes;
+}
+
+} // namespace freetype
@@ -0,0 +1,409 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/Flattener.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/Flattener.h>
+#include <cppfreetype/Decompose.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace freetype {
+
+void FlattenedOutline::clear()
+{
+    xy.clear();
+    contour_ends.clear();
+}
+
+UInt FlattenedOutline::n_points() const
+{
+    return xy.size() / 2;
+}
+
+UInt FlattenedOutline::n_contours() const
+{
+    return contour_ends.size();
+}
+
+size_t FlattenedOutline::bytes() const
+{
+    return xy.capacity() * sizeof(float)
+         + contour_ends.capacity() * sizeof(UInt);
+}
+
+
+
+
+Flattener::Flattener( float tolerance, float scale ):
+    m_tolerance(tolerance),
+    m_scale(scale),
+    m_out(0),
+    m_x(0),
+    m_y(0),
+    m_start(0)
+{}
+
+float Flattener::tolerance() const
+{
+    return m_tolerance;
+}
+
+void Flattener::set_tolerance( float tolerance )
+{
+    m_tolerance = tolerance;
+}
+
+float Flattener::scale() const
+{
+    return m_scale;
+}
+
+void Flattener::set_scale( float scale )
+{
+    m_scale = scale;
+}
+
+void Flattener::finish_contour()
+{
+    std::vector<float>& xy = m_out->xy;
+    UInt end = xy.size() / 2;
+    if( end == m_start )
+        return;
+
+    // decompose() closes every contour explicitly, drop the repeated point
+    if( end - m_start > 1
+            && xy[2*end-2] == xy[2*m_start]
+            && xy[2*end-1] == xy[2*m_start+1] )
+    {
+        xy.resize( xy.size() - 2 );
+        --end;
+    }
+
+    m_out->contour_ends.push_back( end );
+    m_start = end;
+}
+
+void Flattener::emit( const float cx[4], const float cy[4], UInt n,
+                      float end_x, float end_y )
+{
+    std::vector<float>& xy = m_out->xy;
+    size_t size = xy.size();
+    xy.resize( size + 2*n );
+    evaluate( cx, cy, n, &xy[size] );
+
+    // land exactly on the end point whatever the rounding
+    xy[size + 2*n - 2] = end_x;
+    xy[size + 2*n - 1] = end_y;
+    m_x = end_x;
+    m_y = end_y;
+}
+
+Error Flattener::flatten( const OutlineView& outline, FlattenedOutline& out )
+{
+    out.clear();
+    out.xy.reserve( 2*outline.n_points );
+    out.contour_ends.reserve( outline.n_contours );
+
+    m_out   = &out;
+    m_start = 0;
+    Error error = decompose( outline, *this );
+    if( !error )
+        finish_contour();
+    m_out   = 0;
+    return error;
+}
+
+Error Flattener::flatten( RefPtr<Outline> outline, FlattenedOutline& out )
+{
+    return flatten( outline->view(), out );
+}
+
+Error Flattener::move_to( const FT_Vector& to )
+{
+    finish_contour();
+    m_x = to.x * m_scale;
+    m_y = to.y * m_scale;
+    m_out->xy.push_back( m_x );
+    m_out->xy.push_back( m_y );
+    return 0;
+}
+
+Error Flattener::line_to( const FT_Vector& to )
+{
+    m_x = to.x * m_scale;
+    m_y = to.y * m_scale;
+    m_out->xy.push_back( m_x );
+    m_out->xy.push_back( m_y );
+    return 0;
+}
+
+Error Flattener::conic_to( const FT_Vector& control, const FT_Vector& to )
+{
+    float x0 = m_x,                 y0 = m_y;
+    float x1 = control.x * m_scale, y1 = control.y * m_scale;
+    float x2 = to.x * m_scale,      y2 = to.y * m_scale;
+
+    float ddx = x0 - 2*x1 + x2;
+    float ddy = y0 - 2*y1 + y2;
+    UInt  n   = segments( 2, std::sqrt( ddx*ddx + ddy*ddy ), m_tolerance );
+
+    float cx[4] = { x0, 2*(x1 - x0), ddx, 0 };
+    float cy[4] = { y0, 2*(y1 - y0), ddy, 0 };
+    emit( cx, cy, n, x2, y2 );
+    return 0;
+}
+
+Error Flattener::cubic_to( const FT_Vector& control1,
+                           const FT_Vector& control2,
+                           const FT_Vector& to )
+{
+    float x0 = m_x,                  y0 = m_y;
+    float x1 = control1.x * m_scale, y1 = control1.y * m_scale;
+    float x2 = control2.x * m_scale, y2 = control2.y * m_scale;
+    float x3 = to.x * m_scale,       y3 = to.y * m_scale;
+
+    float ddx0 = x0 - 2*x1 + x2,  ddy0 = y0 - 2*y1 + y2;
+    float ddx1 = x1 - 2*x2 + x3,  ddy1 = y1 - 2*y2 + y3;
+    float dd   = std::sqrt( std::max( ddx0*ddx0 + ddy0*ddy0,
+                                      ddx1*ddx1 + ddy1*ddy1 ) );
+    UInt  n    = segments( 3, dd, m_tolerance );
+
+    float cx[4] = { x0, 3*(x1 - x0), 3*ddx0, x3 - x0 + 3*(x1 - x2) };
+    float cy[4] = { y0, 3*(y1 - y0), 3*ddy0, y3 - y0 + 3*(y1 - y2) };
+    emit( cx, cy, n, x3, y3 );
+    return 0;
+}
+
+UInt Flattener::segments( UInt degree, float dd, float tolerance )
+{
+    // Wang's formula: n >= sqrt( d(d-1)/8 * max|second difference| / tol )
+    if( !( tolerance > 0 ) )
+        return MAX_SEGMENTS;
+
+    float n = std::ceil( std::sqrt( degree*(degree-1) * dd
+                                        / ( 8 * tolerance ) ) );
+    if( n < 1 )
+        return 1;
+    if( n > MAX_SEGMENTS )
+        return MAX_SEGMENTS;
+    return (UInt)n;
+}
+
+void Flattener::evaluate( const float cx[4], const float cy[4], UInt n,
+                          float* xy )
+{
+    float step = 1.0f / n;
+    UInt  k    = 0;
+
+#if defined(__AVX2__)
+    {
+        const __m256 ax = _mm256_set1_ps(cx[0]), ay = _mm256_set1_ps(cy[0]);
+        const __m256 bx = _mm256_set1_ps(cx[1]), by = _mm256_set1_ps(cy[1]);
+        const __m256 qx = _mm256_set1_ps(cx[2]), qy = _mm256_set1_ps(cy[2]);
+        const __m256 dx = _mm256_set1_ps(cx[3]), dy = _mm256_set1_ps(cy[3]);
+        const __m256 dt = _mm256_set1_ps(step);
+        const __m256 lanes = _mm256_set_ps( 8, 7, 6, 5, 4, 3, 2, 1 );
+
+        for( ; k + 8 <= n; k += 8 )
+        {
+            __m256 t = _mm256_mul_ps(
+                        _mm256_add_ps( _mm256_set1_ps((float)k), lanes ), dt );
+            __m256 x = _mm256_add_ps( _mm256_mul_ps( dx, t ), qx );
+            __m256 y = _mm256_add_ps( _mm256_mul_ps( dy, t ), qy );
+            x = _mm256_add_ps( _mm256_mul_ps( x, t ), bx );
+            y = _mm256_add_ps( _mm256_mul_ps( y, t ), by );
+            x = _mm256_add_ps( _mm256_mul_ps( x, t ), ax );
+            y = _mm256_add_ps( _mm256_mul_ps( y, t ), ay );
+
+            // interleave, unpack works within 128 bit lanes
+            __m256 lo = _mm256_unpacklo_ps( x, y );
+            __m256 hi = _mm256_unpackhi_ps( x, y );
+            _mm256_storeu_ps( xy + 2*k,
+                              _mm256_permute2f128_ps( lo, hi, 0x20 ) );
+            _mm256_storeu_ps( xy + 2*k + 8,
+                              _mm256_permute2f128_ps( lo, hi, 0x31 ) );
+        }
+    }
+#elif defined(__SSE2__)
+    {
+        const __m128 ax = _mm_set1_ps(cx[0]), ay = _mm_set1_ps(cy[0]);
+        const __m128 bx = _mm_set1_ps(cx[1]), by = _mm_set1_ps(cy[1]);
+        const __m128 qx = _mm_set1_ps(cx[2]), qy = _mm_set1_ps(cy[2]);
+        const __m128 dx = _mm_set1_ps(cx[3]), dy = _mm_set1_ps(cy[3]);
+        const __m128 dt = _mm_set1_ps(step);
+        const __m128 lanes = _mm_set_ps( 4, 3, 2, 1 );
+
+        for( ; k + 4 <= n; k += 4 )
+        {
+            __m128 t = _mm_mul_ps(
+                        _mm_add_ps( _mm_set1_ps((float)k), lanes ), dt );
+            __m128 x = _mm_add_ps( _mm_mul_ps( dx, t ), qx );
+            __m128 y = _mm_add_ps( _mm_mul_ps( dy, t ), qy );
+            x = _mm_add_ps( _mm_mul_ps( x, t ), bx );
+            y = _mm_add_ps( _mm_mul_ps( y, t ), by );
+            x = _mm_add_ps( _mm_mul_ps( x, t ), ax );
+            y = _mm_add_ps( _mm_mul_ps( y, t ), ay );
+
+            _mm_storeu_ps( xy + 2*k,     _mm_unpacklo_ps( x, y ) );
+            _mm_storeu_ps( xy + 2*k + 4, _mm_unpackhi_ps( x, y ) );
+        }
+    }
+#endif
+
+    for( ; k < n; k++ )
+    {
+        float t = (k + 1) * step;
+        xy[2*k]   = ( ( cx[3]*t + cx[2] )*t + cx[1] )*t + cx[0];
+        xy[2*k+1] = ( ( cy[3]*t + cy[2] )*t + cy[1] )*t + cy[0];
+    }
+}
+
+
+
+
+FlattenKey::FlattenKey():
+    tolerance(0),
+    scale(0)
+{}
+
+FlattenKey FlattenKey::make( RefPtr<Face>& face,
+                             UInt          glyph_index,
+                             Int32         load_flags,
+                             float         tolerance,
+                             float         scale )
+{
+    FlattenKey key;
+    key.glyph     = GlyphKey::make( face, glyph_index, load_flags,
+                                    render_mode::NORMAL );
+    key.tolerance = tolerance;
+    key.scale     = scale;
+    return key;
+}
+
+bool FlattenKey::operator==( const FlattenKey& other ) const
+{
+    return glyph     == other.glyph
+        && tolerance == other.tolerance
+        && scale     == other.scale;
+}
+
+size_t FlattenKeyHash::operator()( const FlattenKey& key ) const
+{
+    UInt32 bits[2];
+    std::memcpy( &bits[0], &key.tolerance, sizeof(float) );
+    std::memcpy( &bits[1], &key.scale,     sizeof(float) );
+
+    size_t h = GlyphKeyHash()( key.glyph );
+    h ^= ( (size_t)bits[0] * 0x9E3779B1u ) + ( (size_t)bits[1] << 7 );
+    return h;
+}
+
+
+
+
+namespace {
+
+/// matches the keys of the outlines loaded from one face
+struct SameFace
+{
+    FT_Face face;
+
+    bool operator()( const FlattenKey& key ) const
+    {
+        return key.glyph.face == face;
+    }
+};
+
+}
+
+FlattenCache::FlattenCache( size_t budget ):
+    Lru_t(budget)
+{}
+
+const FlattenedOutline* FlattenCache::lookup( RefPtr<Face>& face,
+                                              UInt          glyph_index,
+                                              Int32         load_flags,
+                                              float         tolerance,
+                                              float         scale )
+{
+    return lookup_e( face, glyph_index, load_flags, tolerance, scale ).p1;
+}
+
+RValuePair< const FlattenedOutline*, Error > FlattenCache::lookup_e(
+                                              RefPtr<Face>& face,
+                                              UInt          glyph_index,
+                                              Int32         load_flags,
+                                              float         tolerance,
+                                              float         scale )
+{
+    typedef RValuePair< const FlattenedOutline*, Error > Result_t;
+
+    FlattenKey key = FlattenKey::make( face, glyph_index, load_flags,
+                                       tolerance, scale );
+
+    const FlattenedOutline* found = find(key);
+    if( found )
+        return Result_t( found, 0 );
+
+    Error err = face->load_glyph( glyph_index, load_flags );
+    if( err )
+        return Result_t( 0, err );
+
+    FT_GlyphSlot slot = face.subvert()->glyph;
+    if( slot->format != FT_GLYPH_FORMAT_OUTLINE )
+        return Result_t( 0, FT_Err_Invalid_Glyph_Format );
+
+    // flatten straight into the new entry at the front of the list
+    Lru_t::Entry& entry = prepare(key);
+
+    m_flattener.set_tolerance( tolerance );
+    m_flattener.set_scale( scale );
+    err = m_flattener.flatten( RefPtr<Outline>( &slot->outline ),
+                               entry.value );
+    if( err )
+    {
+        discard();
+        return Result_t( 0, err );
+    }
+
+    commit();
+    return Result_t( &entry.value, 0 );
+}
+
+void FlattenCache::purge( RefPtr<Face>& face )
+{
+    SameFace match = { face.subvert() };
+    erase_if( match );
+}
+
+} // namespace freetype
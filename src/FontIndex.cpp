@@ -0,0 +1,711 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/FontIndex.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/FontIndex.h>
+#include <cppfreetype/cppfreetype.h>
+#include <cppfreetype/MappedFile.h>
+
+#include <dirent.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <utility>
+
+namespace freetype {
+
+namespace {
+
+typedef unsigned long long  U64;
+typedef long long           I64;
+
+const char   MAGIC[8]   = { 'C','P','P','F','T','F','I','\0' };
+const UInt32 ORDER_MARK = 0x01020304;
+
+/// a font file found by the directory walk
+struct FileInfo
+{
+    std::string filepath;
+    U64         size;
+    I64         mtime_sec;
+    I64         mtime_nsec;
+
+    bool operator<( const FileInfo& other ) const
+    {
+        return filepath < other.filepath;
+    }
+};
+
+bool entry_less( const FontEntry& a, const FontEntry& b )
+{
+    if( a.filepath != b.filepath )
+        return a.filepath < b.filepath;
+    return a.face_index < b.face_index;
+}
+
+/// whether @p name ends in the extension of a format FreeType reads
+bool is_font_file( const char* name )
+{
+    static const char* const extensions[] =
+    {
+        "ttf", "otf", "ttc", "otc", "pfa", "pfb", "pcf", "bdf",
+        "woff", "woff2", "dfont"
+    };
+
+    const char* dot = std::strrchr( name, '.' );
+    if( !dot )
+        return false;
+
+    for( size_t i=0; i < sizeof(extensions)/sizeof(extensions[0]); i++ )
+    {
+        if( strcasecmp( dot + 1, extensions[i] ) == 0 )
+            return true;
+    }
+    return false;
+}
+
+/// append the font files below @p directory to @p out
+Error walk( const std::string& directory,
+            std::set< std::pair<U64,U64> >& visited,
+            std::vector<FileInfo>& out )
+{
+    struct stat info;
+    if( stat( directory.c_str(), &info ) != 0 )
+        return FT_Err_Cannot_Open_Resource;
+
+    // symbolic links may lead back to a directory we are already in
+    if( !visited.insert( std::make_pair( (U64)info.st_dev,
+                                         (U64)info.st_ino ) ).second )
+        return 0;
+
+    DIR* dir = opendir( directory.c_str() );
+    if( !dir )
+        return FT_Err_Cannot_Open_Resource;
+
+    Error err = 0;
+    for( struct dirent* ent = readdir(dir); ent; ent = readdir(dir) )
+    {
+        if( ent->d_name[0] == '.' )
+            continue;
+
+        std::string path = directory + "/" + ent->d_name;
+        if( stat( path.c_str(), &info ) != 0 )
+            continue;
+
+        if( S_ISDIR(info.st_mode) )
+        {
+            Error sub = walk( path, visited, out );
+            if( !err )
+                err = sub;
+        }
+        else if( S_ISREG(info.st_mode) && is_font_file(ent->d_name) )
+        {
+            FileInfo file;
+            file.filepath   = path;
+            file.size       = info.st_size;
+            file.mtime_sec  = info.st_mtim.tv_sec;
+            file.mtime_nsec = info.st_mtim.tv_nsec;
+            out.push_back( file );
+        }
+    }
+
+    closedir(dir);
+    return err;
+}
+
+/// whether @p err from opening a file says it is not a font, rather than
+/// that it could not be opened right now (e.g. out of descriptors)
+bool is_rejection( Error err )
+{
+    return err == FT_Err_Unknown_File_Format
+        || err == FT_Err_Invalid_File_Format;
+}
+
+/// record face @p face_index of @p file
+Error record( RefPtr<Library>& library, const FileInfo& file,
+              Long face_index, FontEntry& entry )
+{
+    RefPtr<Face> face;
+    Error        err;
+    (face, err) = library->new_face_e( file.filepath.c_str(), face_index );
+    if( err )
+        return err;
+
+    entry.filepath    = file.filepath;
+    entry.face_index  = face_index;
+    entry.num_faces   = face->num_faces();
+    entry.family_name = face->family_name() ? face->family_name() : "";
+    entry.style_name  = face->style_name()  ? face->style_name()  : "";
+    entry.style_flags = face->style_flags();
+    entry.face_flags  = face->face_flags();
+    entry.num_glyphs  = face->num_glyphs();
+    entry.file_size   = file.size;
+    entry.mtime_sec   = file.mtime_sec;
+    entry.mtime_nsec  = file.mtime_nsec;
+    entry.coverage.build( face );
+    return 0;
+}
+
+/// open every face of the files handed out by @p next, storing the error
+/// from opening the first face of each file in @p errors
+void work( const std::vector<FileInfo>* files, std::atomic<size_t>* next,
+           std::vector< std::vector<FontEntry> >* results,
+           std::vector<Error>* errors )
+{
+    // without a library this worker takes no files, they are left to the
+    // others or, failing that, tried again by the next scan
+    RefPtr<Library> library;
+    Error           err;
+    (library, err) = init_e();
+    if( err )
+        return;
+
+    for( size_t i; ( i = next->fetch_add(1) ) < files->size(); )
+    {
+        std::vector<FontEntry>& out = (*results)[i];
+        out.push_back( FontEntry() );
+        (*errors)[i] = record( library, (*files)[i], 0, out.back() );
+        if( (*errors)[i] )
+        {
+            out.clear();
+            continue;
+        }
+
+        // the remaining faces of a collection
+        Long num_faces = out.back().num_faces;
+        for( Long face_index=1; face_index < num_faces; face_index++ )
+        {
+            out.push_back( FontEntry() );
+            if( record( library, (*files)[i], face_index, out.back() ) )
+                out.pop_back();
+        }
+    }
+
+    done( library );
+}
+
+/// appends plain values to a byte buffer
+struct Writer
+{
+    std::vector<Byte> buffer;
+
+    void put( const void* data, size_t size )
+    {
+        const Byte* bytes = (const Byte*)data;
+        buffer.insert( buffer.end(), bytes, bytes + size );
+    }
+
+    template <typename T>
+    void put( T value )
+    {
+        put( &value, sizeof(value) );
+    }
+
+    void put_string( const std::string& str )
+    {
+        put<UInt32>( str.size() );
+        put( str.data(), str.size() );
+    }
+};
+
+/// reads plain values from a byte range, failing past its end
+struct Reader
+{
+    const Byte* p;
+    const Byte* limit;
+
+    bool get( void* out, size_t size )
+    {
+        if( size == 0 )
+            return true;
+        if( (size_t)( limit - p ) < size )
+            return false;
+        std::memcpy( out, p, size );
+        p += size;
+        return true;
+    }
+
+    template <typename T>
+    bool get( T& value )
+    {
+        return get( &value, sizeof(value) );
+    }
+
+    bool get_string( std::string& str )
+    {
+        UInt32 size;
+        if( !get(size) || (size_t)( limit - p ) < size )
+            return false;
+        str.assign( (const char*)p, size );
+        p += size;
+        return true;
+    }
+};
+
+/// index @p files, sorted by path, taking the entries of files which did
+/// not change from @p old_faces and @p old_rejected and opening the rest
+/**
+ *  @return the number of files opened
+ */
+size_t index_files( const std::vector<FileInfo>& files,
+                    std::vector<FontEntry>& old_faces,
+                    std::vector<FontEntry>& old_rejected,
+                    UInt threads,
+                    std::vector<FontEntry>& faces,
+                    std::vector<FontEntry>& rejected )
+{
+    // old_faces is sorted by path so each file's faces are one range
+    std::vector<FileInfo> stale;
+    for( size_t i=0; i < files.size(); i++ )
+    {
+        const FileInfo& file = files[i];
+
+        FontEntry probe;
+        probe.filepath = file.filepath;
+
+        // files FreeType could not open are not tried again until they
+        // change
+        std::vector<FontEntry>::iterator known =
+            std::lower_bound( old_rejected.begin(), old_rejected.end(),
+                              probe, entry_less );
+        if( known != old_rejected.end() && known->filepath == file.filepath
+                && known->file_size  == file.size
+                && known->mtime_sec  == file.mtime_sec
+                && known->mtime_nsec == file.mtime_nsec )
+        {
+            rejected.push_back( *known );
+            continue;
+        }
+
+        std::vector<FontEntry>::iterator first =
+            std::lower_bound( old_faces.begin(), old_faces.end(), probe,
+                              entry_less );
+        std::vector<FontEntry>::iterator last = first;
+        while( last != old_faces.end() && last->filepath == file.filepath
+                && last->file_size  == file.size
+                && last->mtime_sec  == file.mtime_sec
+                && last->mtime_nsec == file.mtime_nsec )
+            ++last;
+
+        bool fresh = last != first
+                  && ( last == old_faces.end()
+                        || last->filepath != file.filepath );
+        if( !fresh )
+        {
+            stale.push_back( file );
+            continue;
+        }
+
+        for( ; first != last; ++first )
+        {
+            faces.push_back( FontEntry() );
+            std::swap( faces.back(), *first );
+        }
+    }
+
+    if( stale.empty() )
+        return 0;
+
+    if( !threads )
+        threads = std::max( 1U, std::thread::hardware_concurrency() );
+    threads = (UInt)std::min<size_t>( threads, stale.size() );
+
+    std::atomic<size_t>                    next(0);
+    std::vector< std::vector<FontEntry> >  results( stale.size() );
+    std::vector< Error >                   errors( stale.size(), 0 );
+    std::vector< std::thread >             workers;
+    for( UInt i=0; i < threads; i++ )
+        workers.push_back( std::thread( work, &stale, &next, &results,
+                                        &errors ) );
+    for( UInt i=0; i < threads; i++ )
+        workers[i].join();
+
+    for( size_t i=0; i < results.size(); i++ )
+    {
+        // only files which are not fonts are remembered, the others are
+        // opened again by the next scan
+        if( is_rejection( errors[i] ) )
+        {
+            rejected.push_back( FontEntry() );
+            rejected.back().filepath   = stale[i].filepath;
+            rejected.back().file_size  = stale[i].size;
+            rejected.back().mtime_sec  = stale[i].mtime_sec;
+            rejected.back().mtime_nsec = stale[i].mtime_nsec;
+        }
+
+        for( size_t j=0; j < results[i].size(); j++ )
+        {
+            faces.push_back( FontEntry() );
+            std::swap( faces.back(), results[i][j] );
+        }
+    }
+
+    return stale.size();
+}
+
+bool same_path( const FileInfo& a, const FileInfo& b )
+{
+    return a.filepath == b.filepath;
+}
+
+/// whether @p filepath is @p path or lies below it
+bool is_below( const std::string& filepath, const std::string& path )
+{
+    return filepath.compare( 0, path.size(), path ) == 0
+        && ( filepath.size() == path.size()
+                || filepath[ path.size() ] == '/' );
+}
+
+}
+
+const UInt32 FontIndex::VERSION;
+
+FontEntry::FontEntry():
+    face_index(0),
+    num_faces(0),
+    style_flags(0),
+    face_flags(0),
+    num_glyphs(0),
+    file_size(0),
+    mtime_sec(0),
+    mtime_nsec(0)
+{}
+
+FontIndex::FontIndex():
+    m_opened(0)
+{}
+
+Error FontIndex::scan( const std::vector<std::string>& directories,
+                       UInt threads )
+{
+    Error                           err = 0;
+    std::vector<FileInfo>           files;
+    std::set< std::pair<U64,U64> >  visited;
+    for( size_t i=0; i < directories.size(); i++ )
+    {
+        Error sub = walk( directories[i], visited, files );
+        if( !err )
+            err = sub;
+    }
+    std::sort( files.begin(), files.end() );
+
+    std::vector<FontEntry> faces;
+    std::vector<FontEntry> rejected;
+    m_opened = index_files( files, m_faces, m_rejected, threads,
+                            faces, rejected );
+
+    std::sort( faces.begin(), faces.end(), entry_less );
+    std::sort( rejected.begin(), rejected.end(), entry_less );
+    m_faces.swap( faces );
+    m_rejected.swap( rejected );
+    return err;
+}
+
+Error FontIndex::update( const FontIndex& previous,
+                         const std::vector<std::string>& paths,
+                         UInt threads )
+{
+    // entries outside of the changed paths are taken as they are, those
+    // inside are only candidates for reuse
+    std::vector<FontEntry> faces;
+    std::vector<FontEntry> rejected;
+    std::vector<FontEntry> old_faces;
+    std::vector<FontEntry> old_rejected;
+    for( int list=0; list < 2; list++ )
+    {
+        const std::vector<FontEntry>& from =
+            list ? previous.m_rejected : previous.m_faces;
+        for( size_t i=0; i < from.size(); i++ )
+        {
+            bool changed = false;
+            for( size_t j=0; j < paths.size() && !changed; j++ )
+                changed = is_below( from[i].filepath, paths[j] );
+
+            std::vector<FontEntry>& to = list
+                ? ( changed ? old_rejected : rejected )
+                : ( changed ? old_faces    : faces );
+            to.push_back( from[i] );
+        }
+    }
+
+    // a path may be a new or changed file or directory, or be gone
+    Error                           err = 0;
+    std::vector<FileInfo>           files;
+    std::set< std::pair<U64,U64> >  visited;
+    for( size_t i=0; i < paths.size(); i++ )
+    {
+        struct stat info;
+        if( stat( paths[i].c_str(), &info ) != 0 )
+            continue;
+
+        if( S_ISDIR(info.st_mode) )
+        {
+            Error sub = walk( paths[i], visited, files );
+            if( !err )
+                err = sub;
+        }
+        else if( S_ISREG(info.st_mode) && is_font_file( paths[i].c_str() ) )
+        {
+            FileInfo file;
+            file.filepath   = paths[i];
+            file.size       = info.st_size;
+            file.mtime_sec  = info.st_mtim.tv_sec;
+            file.mtime_nsec = info.st_mtim.tv_nsec;
+            files.push_back( file );
+        }
+    }
+
+    std::sort( files.begin(), files.end() );
+    std::vector<FileInfo>::iterator last =
+        std::unique( files.begin(), files.end(), same_path );
+    files.erase( last, files.end() );
+
+    m_opened = index_files( files, old_faces, old_rejected, threads,
+                            faces, rejected );
+
+    std::sort( faces.begin(), faces.end(), entry_less );
+    std::sort( rejected.begin(), rejected.end(), entry_less );
+    m_faces.swap( faces );
+    m_rejected.swap( rejected );
+    return err;
+}
+
+Error FontIndex::load( const char* filepath )
+{
+    RValuePair< MappedFile*, Error > mapped = MappedFile::open( filepath );
+    if( mapped.p2 )
+        return mapped.p2;
+
+    MappedFile* file = mapped.p1;
+    Reader      in   = { file->data(), file->data() + file->size() };
+
+    char   magic[8];
+    UInt32 version;
+    UInt32 order;
+    UInt32 n_faces;
+    if( !in.get( magic, sizeof(magic) )
+            || std::memcmp( magic, MAGIC, sizeof(MAGIC) ) != 0
+            || !in.get(version) || !in.get(order) || !in.get(n_faces) )
+    {
+        file->release();
+        return FT_Err_Unknown_File_Format;
+    }
+
+    if( version != VERSION || order != ORDER_MARK )
+    {
+        file->release();
+        return FT_Err_Invalid_Version;
+    }
+
+    std::vector<FontEntry>              faces;
+    std::vector<UInt32>                 pages;
+    std::vector<Coverage::Word_t>       bits;
+    bool ok = true;
+    for( UInt32 i=0; ok && i < n_faces; i++ )
+    {
+        faces.push_back( FontEntry() );
+        FontEntry& entry = faces.back();
+
+        I64    face_index, num_faces, style_flags, face_flags, num_glyphs;
+        UInt32 n_pages;
+        ok = in.get_string( entry.filepath )
+          && in.get( face_index ) && in.get( num_faces )
+          && in.get_string( entry.family_name )
+          && in.get_string( entry.style_name )
+          && in.get( style_flags ) && in.get( face_flags )
+          && in.get( num_glyphs )
+          && in.get( entry.file_size )
+          && in.get( entry.mtime_sec ) && in.get( entry.mtime_nsec )
+          && in.get( n_pages )
+          && (size_t)( in.limit - in.p ) / ( sizeof(UInt32)
+                + Coverage::PAGE_WORDS * sizeof(Coverage::Word_t) )
+                    >= n_pages;
+        if( !ok )
+            break;
+
+        pages.resize( n_pages );
+        bits.resize( (size_t)n_pages * Coverage::PAGE_WORDS );
+        in.get( pages.empty() ? 0 : &pages[0],
+                pages.size() * sizeof(UInt32) );
+        in.get( bits.empty() ? 0 : &bits[0],
+                bits.size() * sizeof(Coverage::Word_t) );
+
+        entry.face_index  = face_index;
+        entry.num_faces   = num_faces;
+        entry.style_flags = style_flags;
+        entry.face_flags  = face_flags;
+        entry.num_glyphs  = num_glyphs;
+        entry.coverage.assign( pages.empty() ? 0 : &pages[0],
+                               bits.empty()  ? 0 : &bits[0], n_pages );
+    }
+
+    UInt32 n_rejected = 0;
+    ok = ok && in.get( n_rejected );
+
+    std::vector<FontEntry> rejected;
+    for( UInt32 i=0; ok && i < n_rejected; i++ )
+    {
+        rejected.push_back( FontEntry() );
+        FontEntry& entry = rejected.back();
+        ok = in.get_string( entry.filepath )
+          && in.get( entry.file_size )
+          && in.get( entry.mtime_sec ) && in.get( entry.mtime_nsec );
+    }
+
+    file->release();
+    if( !ok )
+        return FT_Err_Unknown_File_Format;
+
+    std::sort( faces.begin(), faces.end(), entry_less );
+    std::sort( rejected.begin(), rejected.end(), entry_less );
+    m_faces.swap( faces );
+    m_rejected.swap( rejected );
+    return 0;
+}
+
+Error FontIndex::save( const char* filepath ) const
+{
+    Writer out;
+    out.put( MAGIC, sizeof(MAGIC) );
+    out.put<UInt32>( VERSION );
+    out.put<UInt32>( ORDER_MARK );
+    out.put<UInt32>( m_faces.size() );
+
+    for( size_t i=0; i < m_faces.size(); i++ )
+    {
+        const FontEntry& entry = m_faces[i];
+        const Coverage&  cover = entry.coverage;
+        out.put_string( entry.filepath );
+        out.put<I64>( entry.face_index );
+        out.put<I64>( entry.num_faces );
+        out.put_string( entry.family_name );
+        out.put_string( entry.style_name );
+        out.put<I64>( entry.style_flags );
+        out.put<I64>( entry.face_flags );
+        out.put<I64>( entry.num_glyphs );
+        out.put<U64>( entry.file_size );
+        out.put<I64>( entry.mtime_sec );
+        out.put<I64>( entry.mtime_nsec );
+        out.put<UInt32>( cover.num_pages() );
+        out.put( cover.pages(), cover.num_pages() * sizeof(UInt32) );
+        out.put( cover.bits(), cover.num_pages() * Coverage::PAGE_WORDS
+                                    * sizeof(Coverage::Word_t) );
+    }
+
+    out.put<UInt32>( m_rejected.size() );
+    for( size_t i=0; i < m_rejected.size(); i++ )
+    {
+        const FontEntry& entry = m_rejected[i];
+        out.put_string( entry.filepath );
+        out.put<U64>( entry.file_size );
+        out.put<I64>( entry.mtime_sec );
+        out.put<I64>( entry.mtime_nsec );
+    }
+
+    // write a temporary file and rename it over the old one
+    std::string tmp  = std::string(filepath) + ".tmp";
+    std::FILE*  file = std::fopen( tmp.c_str(), "wb" );
+    if( !file )
+        return FT_Err_Cannot_Open_Stream;
+
+    bool ok = std::fwrite( &out.buffer[0], 1, out.buffer.size(), file )
+                == out.buffer.size();
+    if( std::fclose(file) != 0 )
+        ok = false;
+    if( ok && std::rename( tmp.c_str(), filepath ) != 0 )
+        ok = false;
+    if( !ok )
+    {
+        std::remove( tmp.c_str() );
+        return FT_Err_Invalid_Stream_Operation;
+    }
+
+    return 0;
+}
+
+size_t FontIndex::size() const
+{
+    return m_faces.size();
+}
+
+const FontEntry& FontIndex::operator[]( size_t i ) const
+{
+    return m_faces[i];
+}
+
+const FontEntry* FontIndex::find( const char* filepath,
+                                  Long face_index ) const
+{
+    FontEntry probe;
+    probe.filepath   = filepath;
+    probe.face_index = face_index;
+
+    std::vector<FontEntry>::const_iterator iter =
+        std::lower_bound( m_faces.begin(), m_faces.end(), probe, entry_less );
+    if( iter == m_faces.end() || iter->filepath != probe.filepath
+            || iter->face_index != face_index )
+        return 0;
+    return &(*iter);
+}
+
+void FontIndex::find_family( const char* family_name,
+                             std::vector<size_t>& out ) const
+{
+    for( size_t i=0; i < m_faces.size(); i++ )
+    {
+        if( m_faces[i].family_name == family_name )
+            out.push_back(i);
+    }
+}
+
+void FontIndex::find_coverage( ULong charcode,
+                               std::vector<size_t>& out ) const
+{
+    for( size_t i=0; i < m_faces.size(); i++ )
+    {
+        if( m_faces[i].coverage.contains( charcode ) )
+            out.push_back(i);
+    }
+}
+
+size_t FontIndex::files_opened() const
+{
+    return m_opened;
+}
+
+void FontIndex::clear()
+{
+    m_faces.clear();
+    m_rejected.clear();
+    m_opened = 0;
+}
+
+} // namespace freetype
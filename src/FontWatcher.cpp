@@ -0,0 +1,336 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/FontWatcher.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/FontWatcher.h>
+
+#include <set>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace freetype {
+
+#ifdef __linux__
+namespace {
+
+/// events which may change what a directory's fonts are
+const uint32_t WATCH_MASK = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE
+                          | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB
+                          | IN_DELETE_SELF | IN_MOVE_SELF;
+
+/// how long the directories must be quiet before an update, so that a
+/// package installing many fonts causes a single update
+const int QUIET_MS = 250;
+
+}
+#endif
+
+FontWatcher::FontWatcher( const std::vector<std::string>& directories,
+                          UInt threads ):
+    m_directories(directories),
+    m_threads(threads),
+    m_generation(0),
+    m_stop(false),
+    m_inotify(-1)
+{
+    m_wake[0] = -1;
+    m_wake[1] = -1;
+}
+
+FontWatcher::~FontWatcher()
+{
+    stop();
+}
+
+void FontWatcher::publish( FontIndex* index )
+{
+    std::atomic_store( &m_snapshot, Snapshot_t(index) );
+    ++m_generation;
+
+    if( !m_index_path.empty() )
+        index->save( m_index_path.c_str() );
+}
+
+Error FontWatcher::update( const std::vector<std::string>& paths )
+{
+    std::lock_guard<std::mutex> lock( m_update );
+
+    Snapshot_t current = snapshot();
+    FontIndex* next    = new FontIndex();
+    Error      err;
+    if( !current )
+    {
+        // a missing or stale index file only costs a full scan
+        if( !m_index_path.empty() )
+            next->load( m_index_path.c_str() );
+        err = next->scan( m_directories, m_threads );
+    }
+    else if( paths.empty() )
+        err = next->update( *current, m_directories, m_threads );
+    else
+        err = next->update( *current, paths, m_threads );
+
+    publish( next );
+    return err;
+}
+
+#ifdef __linux__
+
+void FontWatcher::watch( const std::string& directory )
+{
+    int wd = inotify_add_watch( m_inotify, directory.c_str(), WATCH_MASK );
+
+    // a directory reached twice, through a symbolic link, has the same
+    // descriptor, and so does a watched directory which was renamed, see
+    // moved()
+    if( wd < 0 || m_watches.count(wd) )
+        return;
+    m_watches[wd] = directory;
+
+    DIR* dir = opendir( directory.c_str() );
+    if( !dir )
+        return;
+
+    for( struct dirent* ent = readdir(dir); ent; ent = readdir(dir) )
+    {
+        if( ent->d_name[0] == '.' )
+            continue;
+
+        std::string path = directory + "/" + ent->d_name;
+        struct stat info;
+        if( stat( path.c_str(), &info ) == 0 && S_ISDIR(info.st_mode) )
+            watch( path );
+    }
+
+    closedir(dir);
+}
+
+void FontWatcher::moved( const std::string& directory )
+{
+    int wd = inotify_add_watch( m_inotify, directory.c_str(), WATCH_MASK );
+    if( wd < 0 )
+        return;
+
+    Watches_t::iterator iter = m_watches.find( wd );
+    if( iter == m_watches.end() )
+    {
+        // moved in from outside the watched directories
+        watch( directory );
+        return;
+    }
+
+    // renamed within them, the watches of the directory and everything
+    // below it still carry the old path
+    std::string from = iter->second;
+    if( from == directory )
+        return;
+
+    for( iter = m_watches.begin(); iter != m_watches.end(); ++iter )
+    {
+        std::string& path = iter->second;
+        if( path.compare( 0, from.size(), from ) == 0
+                && ( path.size() == from.size()
+                        || path[ from.size() ] == '/' ) )
+            path.replace( 0, from.size(), directory );
+    }
+}
+
+void FontWatcher::run()
+{
+    // inotify_event is followed by its name, keep the buffer aligned
+    union
+    {
+        struct inotify_event    event;
+        char                    bytes[64*1024];
+    } buffer;
+
+    std::set<std::string> changed;
+    bool                  overflow = false;
+
+    while( !m_stop )
+    {
+        struct pollfd fds[2];
+        fds[0].fd     = m_inotify;
+        fds[0].events = POLLIN;
+        fds[1].fd     = m_wake[0];
+        fds[1].events = POLLIN;
+
+        int ready = poll( fds, 2, changed.empty() && !overflow ? -1
+                                                               : QUIET_MS );
+        if( m_stop || ( ready > 0 && fds[1].revents ) )
+            break;
+
+        if( ready == 0 )
+        {
+            // quiet for long enough
+            std::vector<std::string> paths;
+            if( !overflow )
+                paths.assign( changed.begin(), changed.end() );
+            update( paths );
+            changed.clear();
+            overflow = false;
+            continue;
+        }
+
+        if( ready < 0 || !( fds[0].revents & POLLIN ) )
+            continue;
+
+        ssize_t size = read( m_inotify, buffer.bytes, sizeof(buffer) );
+        for( ssize_t offset = 0; offset < size; )
+        {
+            const struct inotify_event* event =
+                (const struct inotify_event*)( buffer.bytes + offset );
+            offset += sizeof(struct inotify_event) + event->len;
+
+            if( event->mask & IN_Q_OVERFLOW )
+            {
+                // events were lost, rescan everything
+                overflow = true;
+                continue;
+            }
+
+            Watches_t::iterator iter = m_watches.find( event->wd );
+            if( iter == m_watches.end() )
+                continue;
+
+            if( event->mask & IN_IGNORED )
+            {
+                m_watches.erase( iter );
+                continue;
+            }
+
+            std::string path = iter->second;
+            if( event->len && event->name[0] )
+                path += std::string("/") + event->name;
+
+            if( ( event->mask & IN_ISDIR ) && ( event->mask & IN_CREATE ) )
+                watch( path );
+            else if( ( event->mask & IN_ISDIR )
+                        && ( event->mask & IN_MOVED_TO ) )
+                moved( path );
+
+            changed.insert( path );
+        }
+    }
+}
+
+#else
+
+void FontWatcher::watch( const std::string& )
+{}
+
+void FontWatcher::moved( const std::string& )
+{}
+
+void FontWatcher::run()
+{}
+
+#endif
+
+Error FontWatcher::start( const char* index_path )
+{
+    stop();
+    if( index_path )
+        m_index_path = index_path;
+
+    Error err = update( std::vector<std::string>() );
+
+#ifdef __linux__
+    m_inotify = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+    if( m_inotify < 0 )
+        return err;
+
+    if( pipe( m_wake ) != 0 )
+    {
+        close( m_inotify );
+        m_inotify = -1;
+        return err;
+    }
+
+    for( size_t i=0; i < m_directories.size(); i++ )
+        watch( m_directories[i] );
+
+    m_stop   = false;
+    m_thread = std::thread( &FontWatcher::run, this );
+#endif
+
+    return err;
+}
+
+void FontWatcher::stop()
+{
+#ifdef __linux__
+    if( m_thread.joinable() )
+    {
+        m_stop = true;
+        char byte = 0;
+        if( write( m_wake[1], &byte, 1 ) < 0 )
+        {
+            // the thread also checks m_stop each time poll() returns
+        }
+        m_thread.join();
+    }
+
+    if( m_inotify >= 0 )
+        close( m_inotify );
+    for( int i=0; i < 2; i++ )
+    {
+        if( m_wake[i] >= 0 )
+            close( m_wake[i] );
+        m_wake[i] = -1;
+    }
+#endif
+
+    m_inotify = -1;
+    m_watches.clear();
+}
+
+Error FontWatcher::refresh()
+{
+    return update( std::vector<std::string>() );
+}
+
+FontWatcher::Snapshot_t FontWatcher::snapshot() const
+{
+    return std::atomic_load( &m_snapshot );
+}
+
+ULong FontWatcher::generation() const
+{
+    return m_generation;
+}
+
+bool FontWatcher::watching() const
+{
+    return m_inotify >= 0;
+}
+
+} // namespace freetype
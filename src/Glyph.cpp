@@ -0,0 +1,163 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/Glyph.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/Glyph.h>
+
+namespace freetype {
+
+Glyph::Glyph():
+    m_glyph(0)
+{}
+
+Glyph::Glyph( const Glyph& other ):
+    m_glyph(0)
+{
+    copy( other );
+}
+
+Glyph::~Glyph()
+{
+    release();
+}
+
+Glyph& Glyph::operator=( const Glyph& other )
+{
+    copy( other );
+    return *this;
+}
+
+Error Glyph::get( RefPtr<GlyphSlot> slot )
+{
+    release();
+
+    FT_Glyph glyph = 0;
+    Error    err   = FT_Get_Glyph( slot.subvert(), &glyph );
+    if( err )
+        return err;
+
+    m_library = slot->library();
+    m_glyph   = glyph;
+    return 0;
+}
+
+Error Glyph::copy( const Glyph& other )
+{
+    if( &other == this )
+        return 0;
+
+    release();
+    if( !other.m_glyph )
+        return 0;
+
+    FT_Glyph glyph = 0;
+    Error    err   = FT_Glyph_Copy( other.m_glyph, &glyph );
+    if( err )
+        return err;
+
+    m_library = other.m_library;
+    m_glyph   = glyph;
+    return 0;
+}
+
+void Glyph::release()
+{
+    // the image is freed through the library's memory manager
+    if( m_glyph )
+        FT_Done_Glyph( m_glyph );
+    m_glyph = 0;
+    m_library.unlink();
+}
+
+bool Glyph::is_valid() const
+{
+    return m_glyph;
+}
+
+GlyphFormat Glyph::format() const
+{
+    return (GlyphFormat)m_glyph->format;
+}
+
+const FT_Vector& Glyph::advance() const
+{
+    return m_glyph->advance;
+}
+
+Error Glyph::transform( const FT_Matrix* matrix, const FT_Vector* delta )
+{
+    return FT_Glyph_Transform( m_glyph, const_cast<FT_Matrix*>(matrix),
+                               const_cast<FT_Vector*>(delta) );
+}
+
+FT_BBox Glyph::cbox( UInt bbox_mode ) const
+{
+    FT_BBox bbox;
+    FT_Glyph_Get_CBox( m_glyph, bbox_mode, &bbox );
+    return bbox;
+}
+
+Error Glyph::to_bitmap( render_mode::RenderMode mode,
+                        const FT_Vector* origin )
+{
+    // on success the outline glyph is replaced and freed
+    return FT_Glyph_To_Bitmap( &m_glyph, (FT_Render_Mode)mode,
+                               const_cast<FT_Vector*>(origin), 1 );
+}
+
+RefPtr<Outline> Glyph::outline()
+{
+    if( !m_glyph || m_glyph->format != FT_GLYPH_FORMAT_OUTLINE )
+        return RefPtr<Outline>();
+    return RefPtr<Outline>( &( (FT_OutlineGlyph)m_glyph )->outline );
+}
+
+BitmapView Glyph::bitmap() const
+{
+    if( !m_glyph || m_glyph->format != FT_GLYPH_FORMAT_BITMAP )
+        return BitmapView();
+    return BitmapView( ( (FT_BitmapGlyph)m_glyph )->bitmap );
+}
+
+Int Glyph::bitmap_left() const
+{
+    if( !m_glyph || m_glyph->format != FT_GLYPH_FORMAT_BITMAP )
+        return 0;
+    return ( (FT_BitmapGlyph)m_glyph )->left;
+}
+
+Int Glyph::bitmap_top() const
+{
+    if( !m_glyph || m_glyph->format != FT_GLYPH_FORMAT_BITMAP )
+        return 0;
+    return ( (FT_BitmapGlyph)m_glyph )->top;
+}
+
+FT_Glyph Glyph::subvert()
+{
+    return m_glyph;
+}
+
+} // namespace freetype
@@ -0,0 +1,388 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/GlyphAtlas.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/GlyphAtlas.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+
+namespace freetype {
+
+AtlasRect::AtlasRect( Int x_in, Int y_in, Int width_in, Int height_in ):
+    x(x_in),
+    y(y_in),
+    width(width_in),
+    height(height_in)
+{}
+
+bool AtlasRect::empty() const
+{
+    return width <= 0 || height <= 0;
+}
+
+void AtlasRect::merge( const AtlasRect& other )
+{
+    if( other.empty() )
+        return;
+
+    if( empty() )
+    {
+        *this = other;
+        return;
+    }
+
+    Int x1 = std::max( x + width,  other.x + other.width  );
+    Int y1 = std::max( y + height, other.y + other.height );
+    x      = std::min( x, other.x );
+    y      = std::min( y, other.y );
+    width  = x1 - x;
+    height = y1 - y;
+}
+
+AtlasGlyph::AtlasGlyph():
+    page(0),
+    u0(0),
+    v0(0),
+    u1(0),
+    v1(0),
+    bearing_x(0),
+    bearing_y(0)
+{
+    advance.x = 0;
+    advance.y = 0;
+}
+
+
+
+
+AtlasPage::AtlasPage( Int width, Int height ):
+    m_width(width),
+    m_height(height),
+    m_used(0)
+{
+    clear();
+}
+
+Int AtlasPage::fit( size_t i, Int width, Int height ) const
+{
+    Int x = m_skyline[i].x;
+    if( x + width > m_width )
+        return -1;
+
+    Int y         = m_skyline[i].y;
+    Int remaining = width;
+    for( ; remaining > 0; i++ )
+    {
+        y = std::max( y, m_skyline[i].y );
+        if( y + height > m_height )
+            return -1;
+        remaining -= m_skyline[i].width;
+    }
+
+    return y;
+}
+
+bool AtlasPage::allocate( Int width, Int height, AtlasRect& out )
+{
+    // find the position which leaves the lowest top edge, breaking ties by
+    // the narrowest skyline segment
+    Int    best_top   = m_height + 1;
+    Int    best_width = m_width + 1;
+    Int    best_y     = 0;
+    size_t best       = m_skyline.size();
+
+    for( size_t i=0; i < m_skyline.size(); i++ )
+    {
+        Int y = fit( i, width, height );
+        if( y < 0 )
+            continue;
+
+        if( y + height < best_top
+            || ( y + height == best_top && m_skyline[i].width < best_width ) )
+        {
+            best       = i;
+            best_y     = y;
+            best_top   = y + height;
+            best_width = m_skyline[i].width;
+        }
+    }
+
+    if( best == m_skyline.size() )
+        return false;
+
+    out = AtlasRect( m_skyline[best].x, best_y, width, height );
+
+    // insert the new segment and shrink or remove the ones it shadows
+    Node node = { out.x, out.y + height, width };
+    m_skyline.insert( m_skyline.begin() + best, node );
+
+    for( size_t i = best+1; i < m_skyline.size(); )
+    {
+        Node&       cur  = m_skyline[i];
+        const Node& prev = m_skyline[i-1];
+        Int shrink = prev.x + prev.width - cur.x;
+        if( shrink <= 0 )
+            break;
+
+        cur.x     += shrink;
+        cur.width -= shrink;
+        if( cur.width > 0 )
+            break;
+
+        m_skyline.erase( m_skyline.begin() + i );
+    }
+
+    // merge neighbours at the same height
+    for( size_t i=0; i+1 < m_skyline.size(); )
+    {
+        if( m_skyline[i].y == m_skyline[i+1].y )
+        {
+            m_skyline[i].width += m_skyline[i+1].width;
+            m_skyline.erase( m_skyline.begin() + i + 1 );
+        }
+        else
+            i++;
+    }
+
+    m_used += (ULong)width * height;
+    return true;
+}
+
+void AtlasPage::blit( const Byte* buffer, Int pitch, Byte pixel_mode,
+                      UShort num_grays, const AtlasRect& rect )
+{
+    if( rect.empty() || !buffer )
+        return;
+
+    BitmapView view;
+    view.buffer     = buffer;
+    view.width      = rect.width;
+    view.rows       = rect.height;
+    view.pitch      = pitch;
+    view.pixel_mode = pixel_mode;
+    view.num_grays  = num_grays;
+    view.blit_to( &m_pixels[0], m_width, m_width, m_height,
+                  rect.x, rect.y );
+
+    m_dirty.merge( rect );
+}
+
+Int AtlasPage::width() const
+{
+    return m_width;
+}
+
+Int AtlasPage::height() const
+{
+    return m_height;
+}
+
+const Byte* AtlasPage::pixels() const
+{
+    return m_pixels.empty() ? 0 : &m_pixels[0];
+}
+
+ULong AtlasPage::used() const
+{
+    return m_used;
+}
+
+bool AtlasPage::take_dirty( AtlasRect& rect )
+{
+    rect    = m_dirty;
+    m_dirty = AtlasRect();
+    return !rect.empty();
+}
+
+void AtlasPage::clear()
+{
+    m_pixels.assign( (size_t)m_width * m_height, 0 );
+    m_skyline.clear();
+
+    Node node = { 0, 0, m_width };
+    m_skyline.push_back( node );
+
+    // the whole page needs to be uploaded the first time
+    m_dirty = AtlasRect( 0, 0, m_width, m_height );
+    m_used  = 0;
+}
+
+
+
+
+GlyphAtlas::GlyphAtlas( Int  page_width,
+                        Int  page_height,
+                        Int  padding,
+                        UInt max_pages ):
+    m_page_width(page_width),
+    m_page_height(page_height),
+    m_padding(padding),
+    m_max_pages(max_pages)
+{}
+
+bool GlyphAtlas::insert( const Byte* buffer,
+                         Int         width,
+                         Int         rows,
+                         Int         pitch,
+                         Byte        pixel_mode,
+                         UShort      num_grays,
+                         AtlasGlyph& out )
+{
+    // whitespace glyphs take no room
+    if( width <= 0 || rows <= 0 )
+    {
+        out.page = 0;
+        out.rect = AtlasRect();
+        out.u0 = out.v0 = out.u1 = out.v1 = 0;
+        return true;
+    }
+
+    Int padded_width  = width + m_padding;
+    Int padded_height = rows  + m_padding;
+    if( padded_width > m_page_width || padded_height > m_page_height )
+        return false;
+
+    AtlasRect rect;
+    if( m_pages.empty()
+        || !m_pages.back().allocate( padded_width, padded_height, rect ) )
+    {
+        if( m_max_pages && m_pages.size() >= m_max_pages )
+            return false;
+
+        m_pages.push_back( AtlasPage( m_page_width, m_page_height ) );
+        m_pages.back().allocate( padded_width, padded_height, rect );
+    }
+
+    rect.width  = width;
+    rect.height = rows;
+    m_pages.back().blit( buffer, pitch, pixel_mode, num_grays, rect );
+
+    out.page = m_pages.size() - 1;
+    out.rect = rect;
+    out.u0   = (float)rect.x / m_page_width;
+    out.v0   = (float)rect.y / m_page_height;
+    out.u1   = (float)(rect.x + rect.width)  / m_page_width;
+    out.v1   = (float)(rect.y + rect.height) / m_page_height;
+    return true;
+}
+
+bool GlyphAtlas::insert( RefPtr<GlyphSlot> slot, AtlasGlyph& out )
+{
+    FT_GlyphSlot     ptr    = slot.subvert();
+    const FT_Bitmap& bitmap = ptr->bitmap;
+
+    if( !insert( bitmap.buffer, bitmap.width, bitmap.rows, bitmap.pitch,
+                 bitmap.pixel_mode, bitmap.num_grays, out ) )
+        return false;
+
+    out.bearing_x = ptr->bitmap_left;
+    out.bearing_y = ptr->bitmap_top;
+    out.advance   = ptr->advance;
+    return true;
+}
+
+bool GlyphAtlas::insert( const CachedGlyph& glyph, AtlasGlyph& out )
+{
+    if( !insert( glyph.buffer.empty() ? 0 : &glyph.buffer[0],
+                 glyph.width, glyph.rows, glyph.pitch,
+                 glyph.pixel_mode, glyph.num_grays, out ) )
+        return false;
+
+    out.bearing_x = glyph.bitmap_left;
+    out.bearing_y = glyph.bitmap_top;
+    out.advance   = glyph.advance;
+    return true;
+}
+
+Error GlyphAtlas::add( RefPtr<Face>& face,
+                       UInt          glyph_index,
+                       Int32         load_flags,
+                       AtlasGlyph&   out,
+                       render_mode::RenderMode mode )
+{
+    Error err = face->load_glyph( glyph_index, load_flags );
+    if( err )
+        return err;
+
+    FT_GlyphSlot slot = face.subvert()->glyph;
+    if( slot->format != FT_GLYPH_FORMAT_BITMAP )
+    {
+        err = FT_Render_Glyph( slot, (FT_Render_Mode)mode );
+        if( err )
+            return err;
+    }
+
+    if( !insert( RefPtr<GlyphSlot>(slot,true), out ) )
+        return FT_Err_Out_Of_Memory;
+
+    return 0;
+}
+
+Int GlyphAtlas::page_width() const
+{
+    return m_page_width;
+}
+
+Int GlyphAtlas::page_height() const
+{
+    return m_page_height;
+}
+
+UInt GlyphAtlas::num_pages() const
+{
+    return m_pages.size();
+}
+
+AtlasPage& GlyphAtlas::page( UInt i )
+{
+    return m_pages[i];
+}
+
+const AtlasPage& GlyphAtlas::page( UInt i ) const
+{
+    return m_pages[i];
+}
+
+float GlyphAtlas::efficiency() const
+{
+    if( m_pages.empty() )
+        return 0;
+
+    double used = 0;
+    for( size_t i=0; i < m_pages.size(); i++ )
+        used += m_pages[i].used();
+
+    return used / ( (double)m_pages.size() * m_page_width * m_page_height );
+}
+
+void GlyphAtlas::clear()
+{
+    m_pages.clear();
+}
+
+} // namespace freetype
@@ -0,0 +1,229 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/GlyphBatch.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/GlyphBatch.h>
+
+#include <cstring>
+
+namespace freetype {
+
+BatchGlyph::BatchGlyph():
+    glyph_index(0),
+    error(0),
+    format(FT_GLYPH_FORMAT_NONE),
+    lsb_delta(0),
+    rsb_delta(0),
+    bitmap_left(0),
+    bitmap_top(0),
+    width(0),
+    rows(0),
+    pitch(0),
+    pixel_mode(pixelmode::NONE),
+    num_grays(0),
+    bitmap_offset(0),
+    first_point(0),
+    n_points(0),
+    first_contour(0),
+    n_contours(0),
+    outline_flags(0)
+{
+    advance.x = 0;
+    advance.y = 0;
+    std::memset( &metrics, 0, sizeof(metrics) );
+}
+
+
+
+
+GlyphBatch::GlyphBatch():
+    duplicates(0),
+    m_generation(0)
+{}
+
+void GlyphBatch::clear()
+{
+    glyphs.clear();
+    order.clear();
+    pixels.clear();
+    points.clear();
+    tags.clear();
+    contours.clear();
+    duplicates = 0;
+}
+
+void GlyphBatch::append( FT_GlyphSlot slot, BatchGlyph& glyph )
+{
+    glyph.format    = slot->format;
+    glyph.metrics   = slot->metrics;
+    glyph.advance   = slot->advance;
+    glyph.lsb_delta = slot->lsb_delta;
+    glyph.rsb_delta = slot->rsb_delta;
+
+    if( slot->format == FT_GLYPH_FORMAT_BITMAP )
+    {
+        const FT_Bitmap& bitmap = slot->bitmap;
+        glyph.bitmap_left   = slot->bitmap_left;
+        glyph.bitmap_top    = slot->bitmap_top;
+        glyph.width         = bitmap.width;
+        glyph.rows          = bitmap.rows;
+        glyph.pitch         = bitmap.pitch < 0 ? -bitmap.pitch : bitmap.pitch;
+        glyph.pixel_mode    = bitmap.pixel_mode;
+        glyph.num_grays     = bitmap.num_grays;
+        glyph.bitmap_offset = pixels.size();
+
+        size_t bytes = (size_t)glyph.rows * glyph.pitch;
+        if( !bytes || !bitmap.buffer )
+            return;
+
+        pixels.resize( glyph.bitmap_offset + bytes );
+        Byte* dst = &pixels[glyph.bitmap_offset];
+        if( bitmap.pitch > 0 )
+            std::memcpy( dst, bitmap.buffer, bytes );
+        else
+        {
+            // an upward flowing bitmap, the top row is the last one in memory
+            Int         pitch = glyph.pitch;
+            const Byte* src   = bitmap.buffer + (size_t)(glyph.rows-1)*pitch;
+            for( Int i=0; i < glyph.rows; i++, src -= pitch )
+                std::memcpy( dst + (size_t)i*pitch, src, pitch );
+        }
+    }
+    else if( slot->format == FT_GLYPH_FORMAT_OUTLINE )
+    {
+        const FT_Outline& outline = slot->outline;
+        glyph.first_point   = points.size();
+        glyph.n_points      = outline.n_points;
+        glyph.first_contour = contours.size();
+        glyph.n_contours    = outline.n_contours;
+        glyph.outline_flags = outline.flags;
+
+        points.insert( points.end(), outline.points,
+                       outline.points + outline.n_points );
+        tags.insert( tags.end(), outline.tags,
+                     outline.tags + outline.n_points );
+        contours.insert( contours.end(), outline.contours,
+                         outline.contours + outline.n_contours );
+    }
+}
+
+Error GlyphBatch::load( FT_Face       face,
+                        const UInt*   glyph_indices,
+                        size_t        count,
+                        Int32         load_flags )
+{
+    clear();
+    order.resize( count );
+
+    // a new stamp forgets the glyphs of the previous load without touching
+    // the table, which is only wiped when the stamps wrap around
+    if( ++m_generation == 0 )
+    {
+        Seen none = { 0, 0 };
+        m_seen.assign( m_seen.size(), none );
+        m_generation = 1;
+    }
+
+    if( m_seen.size() < (size_t)face->num_glyphs )
+    {
+        Seen none = { 0, 0 };
+        m_seen.resize( face->num_glyphs, none );
+    }
+
+    Error first_error = 0;
+    for( size_t i=0; i < count; i++ )
+    {
+        UInt index = glyph_indices[i];
+        order[i]   = glyphs.size();
+
+        // indices past the face's glyphs only fail to load, they are not
+        // worth a table entry
+        if( index < m_seen.size() )
+        {
+            Seen& seen = m_seen[index];
+            if( seen.stamp == m_generation )
+            {
+                order[i] = seen.entry;
+                ++duplicates;
+                continue;
+            }
+
+            seen.stamp = m_generation;
+            seen.entry = order[i];
+        }
+
+        glyphs.push_back( BatchGlyph() );
+        BatchGlyph& glyph = glyphs.back();
+        glyph.glyph_index = index;
+        glyph.error       = FT_Load_Glyph( face, index, load_flags );
+
+        if( glyph.error )
+        {
+            if( !first_error )
+                first_error = glyph.error;
+            continue;
+        }
+
+        append( face->glyph, glyph );
+    }
+
+    return first_error;
+}
+
+size_t GlyphBatch::size() const
+{
+    return order.size();
+}
+
+const BatchGlyph& GlyphBatch::operator[]( size_t i ) const
+{
+    return glyphs[ order[i] ];
+}
+
+const Byte* GlyphBatch::bitmap( const BatchGlyph& glyph ) const
+{
+    if( pixels.empty() )
+        return 0;
+    return &pixels[0] + glyph.bitmap_offset;
+}
+
+OutlineView GlyphBatch::outline( const BatchGlyph& glyph ) const
+{
+    OutlineView view;
+    if( glyph.n_points )
+    {
+        view.points = &points[ glyph.first_point ];
+        view.tags   = &tags[ glyph.first_point ];
+    }
+    if( glyph.n_contours )
+        view.contours = &contours[ glyph.first_contour ];
+
+    view.n_points   = glyph.n_points;
+    view.n_contours = glyph.n_contours;
+    view.flags      = glyph.outline_flags;
+    return view;
+}
+
+} // namespace freetype
@@ -0,0 +1,232 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/GlyphCache.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/GlyphCache.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <cstring>
+
+namespace freetype {
+
+GlyphKey::GlyphKey():
+    face(0),
+    x_ppem(0),
+    y_ppem(0),
+    x_scale(0),
+    y_scale(0),
+    glyph_index(0),
+    load_flags(0),
+    render_mode(0)
+{}
+
+GlyphKey GlyphKey::make( RefPtr<Face>& face,
+                         UInt          glyph_index,
+                         Int32         load_flags,
+                         render_mode::RenderMode mode )
+{
+    GlyphKey key;
+    key.face        = face.subvert();
+    key.glyph_index = glyph_index;
+    key.load_flags  = load_flags;
+    key.render_mode = mode;
+
+    if( key.face && key.face->size )
+    {
+        const FT_Size_Metrics& metrics = key.face->size->metrics;
+        key.x_ppem  = metrics.x_ppem;
+        key.y_ppem  = metrics.y_ppem;
+        key.x_scale = metrics.x_scale;
+        key.y_scale = metrics.y_scale;
+    }
+
+    return key;
+}
+
+bool GlyphKey::operator==( const GlyphKey& other ) const
+{
+    return face         == other.face
+        && glyph_index  == other.glyph_index
+        && x_scale      == other.x_scale
+        && y_scale      == other.y_scale
+        && x_ppem       == other.x_ppem
+        && y_ppem       == other.y_ppem
+        && load_flags   == other.load_flags
+        && render_mode  == other.render_mode;
+}
+
+size_t GlyphKeyHash::operator()( const GlyphKey& key ) const
+{
+    // 64bit FNV-1a over the fields, folded to size_t
+    unsigned long long h = 14695981039346656037ULL;
+    const unsigned long long words[] =
+    {
+        (unsigned long long)(size_t)key.face,
+        ((unsigned long long)key.x_ppem << 16) | key.y_ppem,
+        (unsigned long long)key.x_scale,
+        (unsigned long long)key.y_scale,
+        (unsigned long long)key.glyph_index,
+        (unsigned long long)(UInt32)key.load_flags,
+        (unsigned long long)key.render_mode
+    };
+
+    for( unsigned int i=0; i < sizeof(words)/sizeof(words[0]); i++ )
+    {
+        h ^= words[i];
+        h *= 1099511628211ULL;
+    }
+
+    return (size_t)( h ^ (h >> 32) );
+}
+
+
+
+
+CachedGlyph::CachedGlyph():
+    width(0),
+    rows(0),
+    pitch(0),
+    pixel_mode(pixelmode::NONE),
+    num_grays(0),
+    bitmap_left(0),
+    bitmap_top(0),
+    lsb_delta(0),
+    rsb_delta(0)
+{
+    advance.x = 0;
+    advance.y = 0;
+    std::memset( &metrics, 0, sizeof(metrics) );
+}
+
+void CachedGlyph::assign( RefPtr<GlyphSlot> slot )
+{
+    FT_GlyphSlot ptr  = slot.subvert();
+    BitmapView   view = slot->bitmap();
+
+    width       = view.width;
+    rows        = view.rows;
+    pitch       = view.stride();
+    pixel_mode  = view.pixel_mode;
+    num_grays   = view.num_grays;
+    bitmap_left = slot->bitmap_left();
+    bitmap_top  = slot->bitmap_top();
+    advance     = ptr->advance;
+    metrics     = slot->metrics();
+    lsb_delta   = ptr->lsb_delta;
+    rsb_delta   = ptr->rsb_delta;
+
+    buffer.resize( (size_t)rows * pitch );
+    if( buffer.empty() || !view.buffer )
+        return;
+
+    if( view.pitch > 0 )
+        std::memcpy( &buffer[0], view.buffer, buffer.size() );
+    else
+    {
+        // an upward flowing bitmap, store it top-down
+        for( Int i=0; i < rows; i++ )
+            std::memcpy( &buffer[(size_t)i*pitch], view.row(i), pitch );
+    }
+}
+
+size_t CachedGlyph::bytes() const
+{
+    return buffer.capacity();
+}
+
+
+
+
+namespace {
+
+/// matches the keys of the glyphs loaded from one face
+struct SameFace
+{
+    FT_Face face;
+
+    bool operator()( const GlyphKey& key ) const
+    {
+        return key.face == face;
+    }
+};
+
+}
+
+GlyphCache::GlyphCache( size_t budget ):
+    Lru_t(budget)
+{}
+
+const CachedGlyph* GlyphCache::lookup( RefPtr<Face>& face,
+                                       UInt          glyph_index,
+                                       Int32         load_flags,
+                                       render_mode::RenderMode mode )
+{
+    return lookup_e( face, glyph_index, load_flags, mode ).p1;
+}
+
+RValuePair< const CachedGlyph*, Error > GlyphCache::lookup_e(
+                                       RefPtr<Face>& face,
+                                       UInt          glyph_index,
+                                       Int32         load_flags,
+                                       render_mode::RenderMode mode )
+{
+    typedef RValuePair< const CachedGlyph*, Error > Result_t;
+
+    GlyphKey key = GlyphKey::make( face, glyph_index, load_flags, mode );
+
+    const CachedGlyph* found = find(key);
+    if( found )
+        return Result_t( found, 0 );
+
+    Error err = face->load_glyph( glyph_index, load_flags );
+    if( err )
+        return Result_t( 0, err );
+
+    FT_GlyphSlot slot = face.subvert()->glyph;
+    if( slot->format != FT_GLYPH_FORMAT_BITMAP )
+    {
+        err = FT_Render_Glyph( slot, (FT_Render_Mode)mode );
+        if( err )
+            return Result_t( 0, err );
+    }
+
+    // build the new entry in place at the front of the list so that the
+    // bitmap is copied only once
+    Lru_t::Entry& entry = prepare(key);
+    entry.value.assign( RefPtr<GlyphSlot>(slot,true) );
+    commit();
+
+    return Result_t( &entry.value, 0 );
+}
+
+void GlyphCache::purge( RefPtr<Face>& face )
+{
+    SameFace match = { face.subvert() };
+    erase_if( match );
+}
+
+} // namespace freetype
@@ -0,0 +1,601 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/GlyphCacheFile.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/GlyphCacheFile.h>
+#include <cppfreetype/cppfreetype.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace freetype {
+
+namespace {
+
+typedef unsigned long long  U64;
+typedef long long           I64;
+
+const char   MAGIC[8]   = { 'C','P','P','F','T','G','C','\0' };
+const UInt32 ORDER_MARK = 0x01020304;
+const size_t HEAD_BYTES = 64*1024;
+
+/// file header, all offsets are from the start of the file
+struct DiskHeader
+{
+    char    magic[8];
+    UInt32  version;
+    UInt32  byte_order;     ///< ORDER_MARK as written by the writer
+    UInt32  ft_major;
+    UInt32  ft_minor;
+    UInt32  ft_patch;
+    UInt32  font_size;      ///< sizeof(DiskFont)
+    UInt32  entry_size;     ///< sizeof(DiskEntry)
+    UInt32  n_fonts;
+    UInt32  n_entries;
+    UInt32  reserved;
+    U64     fonts_offset;
+    U64     entries_offset;
+    U64     data_offset;
+    U64     file_size;
+};
+
+/// the fingerprint of one face
+struct DiskFont
+{
+    U64     size;
+    I64     mtime_sec;
+    I64     mtime_nsec;
+    U64     head_hash;
+    I64     face_index;
+};
+
+/// one glyph, 64 bit fields first so that the layout has no padding
+struct DiskEntry
+{
+    I64     x_scale;
+    I64     y_scale;
+    I64     advance_x;
+    I64     advance_y;
+    I64     metrics[8];     ///< FT_Glyph_Metrics in declaration order
+    I64     lsb_delta;
+    I64     rsb_delta;
+    U64     data_offset;    ///< first byte of the pixels
+    UInt32  font;           ///< index of the DiskFont
+    UInt32  glyph_index;
+    Int32   load_flags;
+    Int32   render_mode;
+    Int32   width;
+    Int32   rows;
+    Int32   pitch;
+    Int32   bitmap_left;
+    Int32   bitmap_top;
+    UInt16  x_ppem;
+    UInt16  y_ppem;
+    UInt16  num_grays;
+    Byte    pixel_mode;
+    Byte    reserved[5];
+};
+
+/// order of entries in the file
+bool entry_less( const DiskEntry& a, const DiskEntry& b )
+{
+    if( a.font        != b.font )        return a.font        < b.font;
+    if( a.glyph_index != b.glyph_index ) return a.glyph_index < b.glyph_index;
+    if( a.x_ppem      != b.x_ppem )      return a.x_ppem      < b.x_ppem;
+    if( a.y_ppem      != b.y_ppem )      return a.y_ppem      < b.y_ppem;
+    if( a.x_scale     != b.x_scale )     return a.x_scale     < b.x_scale;
+    if( a.y_scale     != b.y_scale )     return a.y_scale     < b.y_scale;
+    if( a.load_flags  != b.load_flags )  return a.load_flags  < b.load_flags;
+    return a.render_mode < b.render_mode;
+}
+
+/// the key fields of @p key, for font record @p font
+DiskEntry probe( const GlyphKey& key, UInt32 font )
+{
+    DiskEntry entry;
+    std::memset( &entry, 0, sizeof(entry) );
+    entry.font        = font;
+    entry.glyph_index = key.glyph_index;
+    entry.x_ppem      = key.x_ppem;
+    entry.y_ppem      = key.y_ppem;
+    entry.x_scale     = key.x_scale;
+    entry.y_scale     = key.y_scale;
+    entry.load_flags  = key.load_flags;
+    entry.render_mode = key.render_mode;
+    return entry;
+}
+
+/// write @p size bytes, false on failure
+bool write( std::FILE* file, const void* data, size_t size )
+{
+    return size == 0 || std::fwrite( data, 1, size, file ) == size;
+}
+
+/// round @p offset up to a multiple of 8
+U64 align8( U64 offset )
+{
+    return ( offset + 7 ) & ~(U64)7;
+}
+
+}
+
+const UInt32 GlyphCacheFile::VERSION;
+const Int    GlyphCacheFile::UNCHECKED;
+const Int    GlyphCacheFile::NO_MATCH;
+
+FontFingerprint::FontFingerprint():
+    size(0),
+    mtime_sec(0),
+    mtime_nsec(0),
+    head_hash(0),
+    face_index(0)
+{}
+
+RValuePair< FontFingerprint, Error > FontFingerprint::make(
+                                                const char* filepath,
+                                                Long face_index )
+{
+    typedef RValuePair< FontFingerprint, Error > Result_t;
+
+    FontFingerprint print;
+    print.face_index = face_index;
+
+    struct stat info;
+    if( stat( filepath, &info ) != 0 )
+        return Result_t( print, FT_Err_Cannot_Open_Resource );
+
+    print.size       = info.st_size;
+    print.mtime_sec  = info.st_mtim.tv_sec;
+    print.mtime_nsec = info.st_mtim.tv_nsec;
+
+    RValuePair< MappedFile*, Error > mapped = MappedFile::open( filepath );
+    if( mapped.p2 )
+        return Result_t( print, mapped.p2 );
+
+    // 64bit FNV-1a
+    const Byte* data  = mapped.p1->data();
+    size_t      count = std::min( (size_t)mapped.p1->size(), HEAD_BYTES );
+    U64         h     = 14695981039346656037ULL;
+    for( size_t i=0; i < count; i++ )
+    {
+        h ^= data[i];
+        h *= 1099511628211ULL;
+    }
+    print.head_hash = h;
+    mapped.p1->release();
+
+    return Result_t( print, 0 );
+}
+
+bool FontFingerprint::operator==( const FontFingerprint& other ) const
+{
+    return size       == other.size
+        && mtime_sec  == other.mtime_sec
+        && mtime_nsec == other.mtime_nsec
+        && head_hash  == other.head_hash
+        && face_index == other.face_index;
+}
+
+GlyphCacheFile::Stats::Stats():
+    hits(0),
+    misses(0),
+    invalid(0)
+{}
+
+GlyphCacheFile::GlyphCacheFile():
+    m_file(0),
+    m_fonts(0),
+    m_entries(0),
+    m_n_fonts(0),
+    m_n_entries(0)
+{}
+
+GlyphCacheFile::~GlyphCacheFile()
+{
+    close();
+}
+
+Error GlyphCacheFile::open( const char* filepath )
+{
+    close();
+
+    RValuePair< MappedFile*, Error > mapped = MappedFile::open( filepath );
+    if( mapped.p2 )
+        return mapped.p2;
+
+    MappedFile* file = mapped.p1;
+    U64         size = file->size();
+
+    DiskHeader header;
+    if( size < sizeof(header) )
+    {
+        file->release();
+        return FT_Err_Unknown_File_Format;
+    }
+    std::memcpy( &header, file->data(), sizeof(header) );
+
+    if( std::memcmp( header.magic, MAGIC, sizeof(MAGIC) ) != 0 )
+    {
+        file->release();
+        return FT_Err_Unknown_File_Format;
+    }
+
+    if( header.version    != VERSION
+            || header.byte_order != ORDER_MARK
+            || header.ft_major   != MAJOR
+            || header.ft_minor   != MINOR
+            || header.ft_patch   != PATCH
+            || header.font_size  != sizeof(DiskFont)
+            || header.entry_size != sizeof(DiskEntry) )
+    {
+        file->release();
+        return FT_Err_Invalid_Version;
+    }
+
+    // the tables must lie within the file, and be aligned to be read in
+    // place. The offsets are checked against the size before anything is
+    // added to them, so a corrupt header can not wrap around.
+    if( header.file_size != size
+            || header.fonts_offset   > size
+            || header.entries_offset > size
+            || header.data_offset    > size
+            || header.n_fonts   > ( size - header.fonts_offset )
+                                        / sizeof(DiskFont)
+            || header.n_entries > ( size - header.entries_offset )
+                                        / sizeof(DiskEntry) )
+    {
+        file->release();
+        return FT_Err_Unknown_File_Format;
+    }
+
+    U64 fonts_end   = header.fonts_offset
+                    + (U64)header.n_fonts * sizeof(DiskFont);
+    U64 entries_end = header.entries_offset
+                    + (U64)header.n_entries * sizeof(DiskEntry);
+    if( header.fonts_offset % 8 || header.entries_offset % 8
+            || header.fonts_offset   < sizeof(header)
+            || header.entries_offset < fonts_end
+            || header.data_offset    < entries_end )
+    {
+        file->release();
+        return FT_Err_Unknown_File_Format;
+    }
+
+    m_file      = file;
+    m_fonts     = file->data() + header.fonts_offset;
+    m_entries   = file->data() + header.entries_offset;
+    m_n_fonts   = header.n_fonts;
+    m_n_entries = header.n_entries;
+
+    // fonts are matched against the new file the next time they are used
+    for( Map_t::iterator iter = m_bindings.begin();
+            iter != m_bindings.end(); ++iter )
+        iter->second.font = UNCHECKED;
+
+    return 0;
+}
+
+void GlyphCacheFile::close()
+{
+    if( m_file )
+        m_file->release();
+
+    m_file      = 0;
+    m_fonts     = 0;
+    m_entries   = 0;
+    m_n_fonts   = 0;
+    m_n_entries = 0;
+}
+
+bool GlyphCacheFile::is_open() const
+{
+    return m_file != 0;
+}
+
+void GlyphCacheFile::attach( RefPtr<Face>& face, const char* filepath,
+                             Long face_index )
+{
+    Binding& binding   = m_bindings[ face.subvert() ];
+    binding.filepath   = filepath;
+    binding.face_index = face_index;
+    binding.font       = UNCHECKED;
+}
+
+void GlyphCacheFile::detach( RefPtr<Face>& face )
+{
+    m_bindings.erase( face.subvert() );
+}
+
+Int GlyphCacheFile::font( Binding& binding )
+{
+    if( binding.font != UNCHECKED )
+        return binding.font;
+
+    binding.font = NO_MATCH;
+    RValuePair< FontFingerprint, Error > print =
+        FontFingerprint::make( binding.filepath.c_str(), binding.face_index );
+    if( print.p2 )
+        return binding.font;
+
+    const DiskFont* fonts = (const DiskFont*)m_fonts;
+    for( UInt32 i=0; i < m_n_fonts; i++ )
+    {
+        FontFingerprint stored;
+        stored.size       = fonts[i].size;
+        stored.mtime_sec  = fonts[i].mtime_sec;
+        stored.mtime_nsec = fonts[i].mtime_nsec;
+        stored.head_hash  = fonts[i].head_hash;
+        stored.face_index = fonts[i].face_index;
+        if( stored == print.p1 )
+        {
+            binding.font = i;
+            break;
+        }
+    }
+
+    if( binding.font == NO_MATCH && m_n_fonts )
+        ++m_stats.invalid;
+    return binding.font;
+}
+
+bool GlyphCacheFile::find( const GlyphKey& key, CachedGlyph& out )
+{
+    Map_t::iterator binding = m_bindings.find( key.face );
+    if( !m_file || binding == m_bindings.end() )
+    {
+        ++m_stats.misses;
+        return false;
+    }
+
+    Int index = font( binding->second );
+    if( index < 0 )
+    {
+        ++m_stats.misses;
+        return false;
+    }
+
+    const DiskEntry* begin = (const DiskEntry*)m_entries;
+    const DiskEntry* end   = begin + m_n_entries;
+    DiskEntry        want  = probe( key, index );
+    const DiskEntry* found = std::lower_bound( begin, end, want, entry_less );
+    if( found == end || entry_less( want, *found ) )
+    {
+        ++m_stats.misses;
+        return false;
+    }
+
+    // the pixels must lie within the file
+    U64 size  = m_file->size();
+    U64 bytes = (U64)(UInt32)found->rows * (UInt32)found->pitch;
+    if( found->rows < 0 || found->pitch < 0 || found->width < 0
+            || found->data_offset > size || bytes > size - found->data_offset )
+    {
+        ++m_stats.invalid;
+        ++m_stats.misses;
+        return false;
+    }
+
+    out.width       = found->width;
+    out.rows        = found->rows;
+    out.pitch       = found->pitch;
+    out.pixel_mode  = found->pixel_mode;
+    out.num_grays   = found->num_grays;
+    out.bitmap_left = found->bitmap_left;
+    out.bitmap_top  = found->bitmap_top;
+    out.advance.x   = found->advance_x;
+    out.advance.y   = found->advance_y;
+    out.lsb_delta   = found->lsb_delta;
+    out.rsb_delta   = found->rsb_delta;
+
+    out.metrics.width        = found->metrics[0];
+    out.metrics.height       = found->metrics[1];
+    out.metrics.horiBearingX = found->metrics[2];
+    out.metrics.horiBearingY = found->metrics[3];
+    out.metrics.horiAdvance  = found->metrics[4];
+    out.metrics.vertBearingX = found->metrics[5];
+    out.metrics.vertBearingY = found->metrics[6];
+    out.metrics.vertAdvance  = found->metrics[7];
+
+    const Byte* pixels = m_file->data() + found->data_offset;
+    out.buffer.assign( pixels, pixels + bytes );
+
+    ++m_stats.hits;
+    return true;
+}
+
+const CachedGlyph* GlyphCacheFile::lookup( GlyphCache&   cache,
+                                           RefPtr<Face>& face,
+                                           UInt          glyph_index,
+                                           Int32         load_flags,
+                                           render_mode::RenderMode mode )
+{
+    GlyphKey key = GlyphKey::make( face, glyph_index, load_flags, mode );
+
+    // find() moves the glyph to the front and counts the hit
+    if( cache.peek(key) )
+        return cache.find(key);
+
+    CachedGlyph glyph;
+    if( find( key, glyph ) )
+        return cache.insert( key, glyph );
+
+    return cache.lookup( face, glyph_index, load_flags, mode );
+}
+
+Error GlyphCacheFile::save( const char* filepath, const GlyphCache& cache )
+{
+    // fingerprint every attached face which has glyphs in the cache
+    std::vector<GlyphKey> keys;
+    cache.keys( keys );
+
+    std::map< FT_Face, UInt32 > font_of;
+    std::vector<DiskFont>       fonts;
+    std::vector<DiskEntry>      entries;
+    std::vector<const CachedGlyph*> glyphs;
+    entries.reserve( keys.size() );
+
+    for( size_t i=0; i < keys.size(); i++ )
+    {
+        const GlyphKey& key = keys[i];
+        Map_t::const_iterator binding = m_bindings.find( key.face );
+        if( binding == m_bindings.end() )
+            continue;
+
+        std::map< FT_Face, UInt32 >::iterator known = font_of.find(key.face);
+        if( known == font_of.end() )
+        {
+            RValuePair< FontFingerprint, Error > print =
+                FontFingerprint::make( binding->second.filepath.c_str(),
+                                       binding->second.face_index );
+            if( print.p2 )
+                continue;
+
+            DiskFont font;
+            font.size       = print.p1.size;
+            font.mtime_sec  = print.p1.mtime_sec;
+            font.mtime_nsec = print.p1.mtime_nsec;
+            font.head_hash  = print.p1.head_hash;
+            font.face_index = print.p1.face_index;
+            UInt32 index = fonts.size();
+            known = font_of.insert( std::make_pair( key.face, index ) ).first;
+            fonts.push_back( font );
+        }
+
+        const CachedGlyph* glyph = cache.peek( key );
+        DiskEntry entry = probe( key, known->second );
+        entry.width       = glyph->width;
+        entry.rows        = glyph->rows;
+        entry.pitch       = glyph->pitch;
+        entry.pixel_mode  = glyph->pixel_mode;
+        entry.num_grays   = glyph->num_grays;
+        entry.bitmap_left = glyph->bitmap_left;
+        entry.bitmap_top  = glyph->bitmap_top;
+        entry.advance_x   = glyph->advance.x;
+        entry.advance_y   = glyph->advance.y;
+        entry.lsb_delta   = glyph->lsb_delta;
+        entry.rsb_delta   = glyph->rsb_delta;
+        entry.metrics[0]  = glyph->metrics.width;
+        entry.metrics[1]  = glyph->metrics.height;
+        entry.metrics[2]  = glyph->metrics.horiBearingX;
+        entry.metrics[3]  = glyph->metrics.horiBearingY;
+        entry.metrics[4]  = glyph->metrics.horiAdvance;
+        entry.metrics[5]  = glyph->metrics.vertBearingX;
+        entry.metrics[6]  = glyph->metrics.vertBearingY;
+        entry.metrics[7]  = glyph->metrics.vertAdvance;
+
+        // stash the position in keys until the entries are sorted
+        entry.data_offset = i;
+        entries.push_back( entry );
+    }
+
+    std::sort( entries.begin(), entries.end(), entry_less );
+
+    DiskHeader header;
+    std::memset( &header, 0, sizeof(header) );
+    std::memcpy( header.magic, MAGIC, sizeof(MAGIC) );
+    header.version        = VERSION;
+    header.byte_order     = ORDER_MARK;
+    header.ft_major       = MAJOR;
+    header.ft_minor       = MINOR;
+    header.ft_patch       = PATCH;
+    header.font_size      = sizeof(DiskFont);
+    header.entry_size     = sizeof(DiskEntry);
+    header.n_fonts        = fonts.size();
+    header.n_entries      = entries.size();
+    header.fonts_offset   = align8( sizeof(header) );
+    header.entries_offset = align8( header.fonts_offset
+                                    + fonts.size() * sizeof(DiskFont) );
+    header.data_offset    = header.entries_offset
+                          + entries.size() * sizeof(DiskEntry);
+
+    // pixels follow the entries in the same order
+    glyphs.reserve( entries.size() );
+    U64 offset = header.data_offset;
+    for( size_t i=0; i < entries.size(); i++ )
+    {
+        const CachedGlyph* glyph = cache.peek( keys[ entries[i].data_offset ] );
+        glyphs.push_back( glyph );
+        entries[i].data_offset = offset;
+        offset += (U64)glyph->rows * glyph->pitch;
+    }
+    header.file_size = offset;
+
+    // write a temporary file and rename it over the old one, so that
+    // mappings of the old file are not disturbed
+    std::string tmp = std::string(filepath) + ".tmp";
+    std::FILE*  out = std::fopen( tmp.c_str(), "wb" );
+    if( !out )
+        return FT_Err_Cannot_Open_Stream;
+
+    static const Byte zeros[8] = { 0 };
+    bool ok = write( out, &header, sizeof(header) )
+           && write( out, zeros, header.fonts_offset - sizeof(header) )
+           && write( out, fonts.empty() ? 0 : &fonts[0],
+                     fonts.size() * sizeof(DiskFont) )
+           && write( out, zeros, header.entries_offset - header.fonts_offset
+                                 - fonts.size() * sizeof(DiskFont) )
+           && write( out, entries.empty() ? 0 : &entries[0],
+                     entries.size() * sizeof(DiskEntry) );
+    for( size_t i=0; ok && i < glyphs.size(); i++ )
+    {
+        const CachedGlyph* glyph = glyphs[i];
+        ok = write( out, glyph->buffer.empty() ? 0 : &glyph->buffer[0],
+                    (size_t)glyph->rows * glyph->pitch );
+    }
+
+    if( std::fclose(out) != 0 )
+        ok = false;
+    if( ok && std::rename( tmp.c_str(), filepath ) != 0 )
+        ok = false;
+    if( !ok )
+    {
+        std::remove( tmp.c_str() );
+        return FT_Err_Invalid_Stream_Operation;
+    }
+
+    return 0;
+}
+
+size_t GlyphCacheFile::size() const
+{
+    return m_n_entries;
+}
+
+const GlyphCacheFile::Stats& GlyphCacheFile::stats() const
+{
+    return m_stats;
+}
+
+void GlyphCacheFile::reset_stats()
+{
+    m_stats = Stats();
+}
+
+} // namespace freetype
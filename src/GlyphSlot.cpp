@@ -136,6 +136,26 @@ Pos GlyphSlotDelegate::rsb_delta( ) const
     return m_ptr->rsb_delta;
 }
 
+BitmapView GlyphSlotDelegate::bitmap() const
+{
+    return BitmapView( m_ptr->bitmap );
+}
+
+Int GlyphSlotDelegate::bitmap_left() const
+{
+    return m_ptr->bitmap_left;
+}
+
+Int GlyphSlotDelegate::bitmap_top() const
+{
+    return m_ptr->bitmap_top;
+}
+
+const GlyphMetrics& GlyphSlotDelegate::metrics() const
+{
+    return m_ptr->metrics;
+}
+
 
 
 
@@ -0,0 +1,242 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/KerningTable.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/KerningTable.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
+
+#include <algorithm>
+
+namespace freetype {
+
+namespace {
+
+inline UInt peek_ushort( const Byte* p )
+{
+    return ( (UInt)p[0] << 8 ) | p[1];
+}
+
+inline Int peek_short( const Byte* p )
+{
+    return (Short)peek_ushort(p);
+}
+
+}
+
+KerningTable::KerningTable():
+    m_stride(1),
+    m_mode(kerning_mode::UNSCALED)
+{
+    m_matrix.assign( 1, 0 );
+}
+
+Pos KerningTable::get_cold( UInt left, UInt right ) const
+{
+    Map_t::const_iterator iter = m_scaled.find( key(left,right) );
+    return iter == m_scaled.end() ? 0 : iter->second;
+}
+
+void KerningTable::fill_matrix()
+{
+    m_matrix.assign( (size_t)m_stride * m_stride, 0 );
+    if( m_stride == 1 )
+        return;
+
+    for( Map_t::const_iterator iter = m_scaled.begin();
+            iter != m_scaled.end(); ++iter )
+    {
+        UInt left  = iter->first >> 32;
+        UInt right = iter->first & 0xFFFFFFFF;
+        UInt l = left  < m_hot.size() ? m_hot[left]  : 0;
+        UInt r = right < m_hot.size() ? m_hot[right] : 0;
+        if( l && r )
+            m_matrix[ l*m_stride + r ] = iter->second;
+    }
+}
+
+Error KerningTable::build( RefPtr<Face>& face )
+{
+    m_pairs.clear();
+
+    FT_Face  ptr    = face.subvert();
+    FT_ULong length = 0;
+    Error    err    = FT_Load_Sfnt_Table( ptr, TTAG_kern, 0, 0, &length );
+    if( err )
+        return err;
+
+    std::vector<Byte> table( length );
+    if( length )
+    {
+        err = FT_Load_Sfnt_Table( ptr, TTAG_kern, 0, &table[0], &length );
+        if( err )
+            return err;
+    }
+
+    // only the version 0 (Microsoft) table is supported, as in FreeType
+    const Byte* p     = length ? &table[0] : 0;
+    const Byte* limit = p + length;
+    if( length < 4 || peek_ushort(p) != 0 )
+        return FT_Err_Table_Missing;
+
+    UInt num_tables = peek_ushort(p+2);
+    p += 4;
+
+    for( UInt t=0; t < num_tables && p + 6 <= limit; t++ )
+    {
+        UInt        sub_length = peek_ushort(p+2);
+        UInt        coverage   = peek_ushort(p+4);
+        const Byte* next       = std::min( p + sub_length, limit );
+
+        // format 0, horizontal, not minimum, not cross-stream, optionally
+        // override
+        if( sub_length < 14 || ( coverage & ~8U ) != 0x0001
+                || p + 14 > limit )
+        {
+            if( sub_length < 6 )
+                break;
+            p = next;
+            continue;
+        }
+
+        UInt num_pairs = peek_ushort(p+6);
+        const Byte* pair = p + 14;
+        num_pairs = std::min<UInt>( num_pairs, ( next - pair ) / 6 );
+
+        for( UInt i=0; i < num_pairs; i++, pair += 6 )
+        {
+            unsigned long long k = key( peek_ushort(pair),
+                                        peek_ushort(pair+2) );
+            Pos value = peek_short(pair+4);
+            if( coverage & 8 )
+                m_pairs[k]  = value;
+            else
+                m_pairs[k] += value;
+        }
+
+        p = next;
+    }
+
+    m_scaled = m_pairs;
+    m_mode   = kerning_mode::UNSCALED;
+    fill_matrix();
+    return 0;
+}
+
+void KerningTable::build( RefPtr<Face>& face, const UInt* glyphs,
+                          size_t count )
+{
+    m_pairs.clear();
+
+    FT_Face ptr = face.subvert();
+    for( size_t i=0; i < count; i++ )
+    {
+        for( size_t j=0; j < count; j++ )
+        {
+            FT_Vector kern;
+            if( FT_Get_Kerning( ptr, glyphs[i], glyphs[j],
+                                FT_KERNING_UNSCALED, &kern ) )
+                continue;
+            if( kern.x )
+                m_pairs[ key(glyphs[i],glyphs[j]) ] = kern.x;
+        }
+    }
+
+    m_scaled = m_pairs;
+    m_mode   = kerning_mode::UNSCALED;
+    fill_matrix();
+}
+
+void KerningTable::set_hot_glyphs( const UInt* glyphs, size_t count )
+{
+    m_hot.clear();
+    m_stride = 1;
+    for( size_t i=0; i < count; i++ )
+    {
+        if( glyphs[i] >= m_hot.size() )
+            m_hot.resize( glyphs[i] + 1, 0 );
+        if( !m_hot[ glyphs[i] ] )
+            m_hot[ glyphs[i] ] = m_stride++;
+    }
+    fill_matrix();
+}
+
+void KerningTable::scale( RefPtr<Face>& face, kerning_mode::KerningMode mode )
+{
+    m_mode   = mode;
+    m_scaled = m_pairs;
+
+    FT_Face ptr = face.subvert();
+    if( mode != kerning_mode::UNSCALED && ptr->size )
+    {
+        const FT_Size_Metrics& metrics = ptr->size->metrics;
+        for( Map_t::iterator iter = m_scaled.begin();
+                iter != m_scaled.end(); ++iter )
+        {
+            // the same conversion as FT_Get_Kerning
+            Pos value = FT_MulFix( iter->second, metrics.x_scale );
+            if( mode != kerning_mode::UNFITTED )
+            {
+                // kerning is scaled down at small sizes
+                if( metrics.x_ppem < 25 )
+                    value = FT_MulDiv( value, metrics.x_ppem, 25 );
+                value = ( value + 32 ) & -64;
+            }
+            iter->second = value;
+        }
+    }
+
+    fill_matrix();
+}
+
+kerning_mode::KerningMode KerningTable::mode() const
+{
+    return m_mode;
+}
+
+const KerningTable::Map_t& KerningTable::pairs() const
+{
+    return m_pairs;
+}
+
+size_t KerningTable::size() const
+{
+    return m_pairs.size();
+}
+
+void KerningTable::clear()
+{
+    m_pairs.clear();
+    m_scaled.clear();
+    m_hot.clear();
+    m_stride = 1;
+    m_mode   = kerning_mode::UNSCALED;
+    m_matrix.assign( 1, 0 );
+}
+
+} // namespace freetype
@@ -25,11 +25,14 @@
  */
 
 #include <cppfreetype/Library.h>
+#include <cppfreetype/MappedFile.h>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_MODULE_H
 
+#include <cstring>
+
 namespace freetype
 {
 
@@ -51,13 +54,18 @@ void RefPtr<Library>::dereference()
 
 
 
-//
-//Library Library::create( Memory memory, Error_t& error )
-//{
-//    FT_Library ptr;
-//    error = FT_New_Library( (FT_Memory) memory.get_ptr(), &ptr );
-//    return Library( (void*) ptr );
-//}
+RefPtr<Library> Library::create( Memory memory )
+{
+    return create_e( memory ).p1;
+}
+
+RValuePair< RefPtr<Library>, Error > Library::create_e( Memory memory )
+{
+    FT_Library ptr = 0;
+    Error      err = FT_New_Library( (FT_Memory) memory.get_ptr(), &ptr );
+    return RValuePair< RefPtr<Library>, Error >(
+                RefPtr<Library>( err ? 0 : ptr ), err );
+}
 
 void LibraryDelegate::add_default_modules()
 {
@@ -82,7 +90,7 @@ RefPtr<Face> LibraryDelegate::new_face(
     const char* filepath,
     Long        face_index )
 {
-    FT_Face ptr;
+    FT_Face ptr = 0;
     FT_New_Face( m_ptr, filepath, face_index, &ptr );
     return RefPtr<Face>(ptr);
 }
@@ -91,12 +99,86 @@ RValuePair< RefPtr<Face>, Error> LibraryDelegate::new_face_e(
     const char* filepath,
     Long        face_index )
 {
-    FT_Face ptr;
+    FT_Face ptr = 0;
     Error   err;
     err = FT_New_Face( m_ptr, filepath, face_index, &ptr );
     return RValuePair< RefPtr<Face>, Error>( RefPtr<Face>(ptr), err );
 }
 
+RefPtr<Face> LibraryDelegate::open_face(
+    const OpenArgs& args,
+    Long            face_index )
+{
+    return open_face_e( args, face_index ).p1;
+}
+
+RValuePair< RefPtr<Face>, Error> LibraryDelegate::open_face_e(
+    const OpenArgs& args,
+    Long            face_index )
+{
+    FT_Face ptr = 0;
+    Error   err;
+    err = FT_Open_Face( m_ptr, args.get_ptr(), face_index, &ptr );
+    return RValuePair< RefPtr<Face>, Error>(
+                RefPtr<Face>( err ? 0 : ptr ), err );
+}
+
+RefPtr<Face> LibraryDelegate::new_memory_face(
+    const Byte* file_base,
+    Long        file_size,
+    Long        face_index )
+{
+    return new_memory_face_e( file_base, file_size, face_index ).p1;
+}
+
+RValuePair< RefPtr<Face>, Error> LibraryDelegate::new_memory_face_e(
+    const Byte* file_base,
+    Long        file_size,
+    Long        face_index )
+{
+    return open_face_e( OpenArgs::memory(file_base, file_size), face_index );
+}
+
+/// close callback of the stream used by new_mapped_face, FreeType calls it
+/// as the very last step of destroying the face (or when opening fails)
+static void close_mapped_stream( FT_Stream stream )
+{
+    MappedFile* file = (MappedFile*)stream->descriptor.pointer;
+    delete stream;
+    file->release();
+}
+
+RefPtr<Face> LibraryDelegate::new_mapped_face(
+    const char* filepath,
+    Long        face_index )
+{
+    return new_mapped_face_e( filepath, face_index ).p1;
+}
+
+RValuePair< RefPtr<Face>, Error> LibraryDelegate::new_mapped_face_e(
+    const char* filepath,
+    Long        face_index )
+{
+    RValuePair< MappedFile*, Error > mapped = MappedFile::open( filepath );
+    if( mapped.p2 )
+        return RValuePair< RefPtr<Face>, Error>( RefPtr<Face>(), mapped.p2 );
+
+    MappedFile* file = mapped.p1;
+
+    // each face needs its own stream since streams carry a read position,
+    // a stream without a read function is treated by FreeType as a memory
+    // stream and frames are read directly out of `base`
+    FT_Stream stream = new FT_StreamRec;
+    std::memset( stream, 0, sizeof(FT_StreamRec) );
+    stream->base                = const_cast<Byte*>( file->data() );
+    stream->size                = file->size();
+    stream->descriptor.pointer  = file;
+    stream->close               = &close_mapped_stream;
+
+    // the stream now owns the reference to the mapping
+    return open_face_e( OpenArgs::custom_stream(stream), face_index );
+}
+
 
 
 
@@ -0,0 +1,227 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/LibraryPool.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/LibraryPool.h>
+#include <cppfreetype/cppfreetype.h>
+
+#include <ft2build.h>
+#include FT_MODULE_H
+
+#include <atomic>
+
+namespace freetype {
+
+namespace {
+
+/// source of unique pool ids, a pool constructed at the address of a
+/// destroyed one must not match the destroyed pool's cached slots
+std::atomic<unsigned long> g_next_pool_id(1);
+
+/// the slot most recently used by this thread
+struct SlotCache
+{
+    ULong               id;
+    LibraryPool::Slot*  slot;
+};
+
+thread_local SlotCache t_cache = { 0, 0 };
+
+}
+
+LibraryPool::Arena::Arena():
+    m_memory(0),
+    m_released(false)
+{
+    m_memory = Memory::create( this );
+}
+
+LibraryPool::Arena::~Arena()
+{
+    m_memory.destroy();
+}
+
+void* LibraryPool::Arena::alloc( long size )
+{
+    return m_slab.alloc( size );
+}
+
+void LibraryPool::Arena::free( void* block )
+{
+    m_slab.free( block );
+
+    // FreeType frees the library record last and does not touch the memory
+    // handle afterwards
+    if( m_released && !m_slab.stats().live_blocks )
+        delete this;
+}
+
+void* LibraryPool::Arena::realloc( long cur_size, long new_size,
+                                   void* block )
+{
+    return m_slab.realloc( cur_size, new_size, block );
+}
+
+Memory LibraryPool::Arena::memory()
+{
+    return m_memory;
+}
+
+void LibraryPool::Arena::release()
+{
+    m_released = true;
+    if( !m_slab.stats().live_blocks )
+        delete this;
+}
+
+LibraryPool::Slot::Slot():
+    arena(0),
+    error(0)
+{}
+
+LibraryPool::Slot::~Slot()
+{
+    // the library goes with its last reference, which may be held by a
+    // Glyph, and takes the arena with it
+    face.unlink();
+    library.unlink();
+    if( arena )
+        arena->release();
+}
+
+LibraryPool::Slot* LibraryPool::local()
+{
+    if( t_cache.id == m_id )
+        return t_cache.slot;
+
+    std::thread::id self = std::this_thread::get_id();
+    Slot*           slot = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Map_t::iterator iter = m_slots.find(self);
+        if( iter != m_slots.end() )
+            slot = iter->second;
+        else
+        {
+            slot = new Slot;
+            m_slots[self] = slot;
+        }
+    }
+
+    // the slot is only ever touched by this thread, so it can be filled in
+    // outside of the lock
+    if( !slot->library )
+    {
+        if( !slot->arena )
+            slot->arena = new Arena();
+
+        (slot->library, slot->error) =
+            Library::create_e( slot->arena->memory() );
+        if( !slot->error )
+        {
+            // the same setup as FT_Init_FreeType, including the properties
+            // from the FREETYPE_PROPERTIES environment variable
+            slot->library->add_default_modules();
+            FT_Set_Default_Properties( slot->library.subvert() );
+            (slot->face, slot->error) =
+                slot->library->new_face_e( m_filepath.c_str(), m_face_index );
+        }
+    }
+
+    t_cache.id   = m_id;
+    t_cache.slot = slot;
+    return slot;
+}
+
+LibraryPool::LibraryPool( const char* filepath, Long face_index ):
+    m_filepath(filepath),
+    m_face_index(face_index),
+    m_id( g_next_pool_id++ )
+{}
+
+LibraryPool::~LibraryPool()
+{
+    for( Map_t::iterator iter = m_slots.begin();
+            iter != m_slots.end(); ++iter )
+        delete iter->second;
+}
+
+RefPtr<Face> LibraryPool::face()
+{
+    Slot* slot = local();
+    return slot->error ? RefPtr<Face>() : slot->face;
+}
+
+RValuePair< RefPtr<Face>, Error > LibraryPool::face_e()
+{
+    Slot* slot = local();
+    return RValuePair< RefPtr<Face>, Error >(
+            slot->error ? RefPtr<Face>() : slot->face, slot->error );
+}
+
+RefPtr<Library> LibraryPool::library()
+{
+    return local()->library;
+}
+
+void LibraryPool::release()
+{
+    Slot* slot = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Map_t::iterator iter = m_slots.find( std::this_thread::get_id() );
+        if( iter != m_slots.end() )
+        {
+            slot = iter->second;
+            m_slots.erase( iter );
+        }
+    }
+
+    if( t_cache.id == m_id )
+    {
+        t_cache.id   = 0;
+        t_cache.slot = 0;
+    }
+
+    delete slot;
+}
+
+size_t LibraryPool::size()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slots.size();
+}
+
+const char* LibraryPool::filepath() const
+{
+    return m_filepath.c_str();
+}
+
+Long LibraryPool::face_index() const
+{
+    return m_face_index;
+}
+
+} // namespace freetype
@@ -0,0 +1,165 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/MappedFile.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/MappedFile.h>
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace freetype {
+
+namespace {
+
+typedef std::pair< unsigned long long, unsigned long long >  FileId_t;
+typedef std::map< FileId_t, MappedFile* >                   Registry_t;
+
+/// the latest mapping of each file, keyed by device and inode
+std::mutex& registry_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+Registry_t& registry()
+{
+    static Registry_t map;
+    return map;
+}
+
+}
+
+MappedFile::MappedFile():
+    m_data(0),
+    m_size(0),
+    m_refs(0),
+    m_device(0),
+    m_inode(0),
+    m_mtime_sec(0),
+    m_mtime_nsec(0)
+{}
+
+MappedFile::~MappedFile()
+{
+    if( m_data )
+        munmap( const_cast<Byte*>(m_data), m_size );
+}
+
+RValuePair< MappedFile*, Error > MappedFile::open( const char* filepath )
+{
+    typedef RValuePair< MappedFile*, Error > Result_t;
+
+    int fd = ::open( filepath, O_RDONLY | O_CLOEXEC );
+    if( fd < 0 )
+        return Result_t( 0, FT_Err_Cannot_Open_Resource );
+
+    struct stat info;
+    if( fstat( fd, &info ) != 0 || info.st_size <= 0 )
+    {
+        ::close(fd);
+        return Result_t( 0, FT_Err_Cannot_Open_Resource );
+    }
+
+    FileId_t id( info.st_dev, info.st_ino );
+
+    std::lock_guard<std::mutex> lock( registry_mutex() );
+    Registry_t::iterator iter = registry().find(id);
+    if( iter != registry().end() )
+    {
+        // a file rewritten in place keeps its inode, and reading past the
+        // end of a file which shrank raises SIGBUS
+        MappedFile* known = iter->second;
+        if( known->m_size == info.st_size
+                && known->m_mtime_sec  == info.st_mtim.tv_sec
+                && known->m_mtime_nsec == info.st_mtim.tv_nsec )
+        {
+            ::close(fd);
+            ++(known->m_refs);
+            return Result_t( known, 0 );
+        }
+    }
+
+    void* data = mmap( 0, info.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    ::close(fd);
+    if( data == MAP_FAILED )
+        return Result_t( 0, FT_Err_Out_Of_Memory );
+
+    MappedFile* file = new MappedFile();
+    file->m_data        = (const Byte*)data;
+    file->m_size        = info.st_size;
+    file->m_refs        = 1;
+    file->m_device      = id.first;
+    file->m_inode       = id.second;
+    file->m_mtime_sec   = info.st_mtim.tv_sec;
+    file->m_mtime_nsec  = info.st_mtim.tv_nsec;
+
+    // a stale mapping stays alive for its holders but is no longer shared
+    registry()[id] = file;
+
+    return Result_t( file, 0 );
+}
+
+void MappedFile::reference()
+{
+    std::lock_guard<std::mutex> lock( registry_mutex() );
+    ++m_refs;
+}
+
+void MappedFile::release()
+{
+    std::lock_guard<std::mutex> lock( registry_mutex() );
+    if( --m_refs > 0 )
+        return;
+
+    Registry_t::iterator iter = registry().find(
+                                        FileId_t( m_device, m_inode ) );
+    if( iter != registry().end() && iter->second == this )
+        registry().erase( iter );
+    delete this;
+}
+
+const Byte* MappedFile::data() const
+{
+    return m_data;
+}
+
+Long MappedFile::size() const
+{
+    return m_size;
+}
+
+size_t MappedFile::num_mapped()
+{
+    std::lock_guard<std::mutex> lock( registry_mutex() );
+    return registry().size();
+}
+
+} // namespace freetype
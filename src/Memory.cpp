@@ -100,9 +100,12 @@ void Memory::destroy()
     if(m_ptr)
     {
         FT_Memory       memory  = (FT_Memory)m_ptr;
-        MemorySlots*    slots   = (MemorySlots*)memory->user;
+
+        // only the slot based manager owns its user data
+        if( memory->alloc == &cpp_freetype_alloc )
+            delete (MemorySlots*)memory->user;
+
         delete memory;
-        delete slots;
         m_ptr = 0;
     }
 }
@@ -126,6 +129,20 @@ Memory Memory::create(  AllocFunc_t     alloc,
     return Memory(memory);
 }
 
+Memory Memory::create(  FT_Alloc_Func   alloc,
+                        FT_Free_Func    free,
+                        FT_Realloc_Func realloc,
+                        void*           user )
+{
+    FT_Memory memory = new FT_MemoryRec_;
+    memory->user    = user;
+    memory->alloc   = alloc;
+    memory->free    = free;
+    memory->realloc = realloc;
+
+    return Memory(memory);
+}
+
 
 
 
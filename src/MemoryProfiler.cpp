@@ -0,0 +1,251 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/MemoryProfiler.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/MemoryProfiler.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace freetype {
+
+namespace {
+
+/// every block is preceded by a header holding its requested size, the
+/// header is as large as the alignment malloc guarantees
+const size_t HEADER = 16;
+
+inline Byte* to_block( void* ptr )
+{
+    return (Byte*)ptr - HEADER;
+}
+
+inline long& size_of( Byte* block )
+{
+    return *(long*)block;
+}
+
+}
+
+MemoryStats::MemoryStats():
+    live_bytes(0),
+    live_blocks(0),
+    peak_bytes(0),
+    alloc_calls(0),
+    free_calls(0),
+    realloc_calls(0),
+    realloc_grow(0),
+    realloc_shrink(0),
+    realloc_moved(0),
+    bytes_allocated(0)
+{
+    for( UInt b=0; b < NUM_BUCKETS; b++ )
+        histogram[b] = 0;
+}
+
+MemoryStats MemoryStats::since( const MemoryStats& before ) const
+{
+    MemoryStats delta;
+    delta.live_bytes        = live_bytes      - before.live_bytes;
+    delta.live_blocks       = live_blocks     - before.live_blocks;
+    delta.peak_bytes        = std::max<Long>( peak_bytes - before.live_bytes,
+                                              delta.live_bytes );
+    delta.alloc_calls       = alloc_calls     - before.alloc_calls;
+    delta.free_calls        = free_calls      - before.free_calls;
+    delta.realloc_calls     = realloc_calls   - before.realloc_calls;
+    delta.realloc_grow      = realloc_grow    - before.realloc_grow;
+    delta.realloc_shrink    = realloc_shrink  - before.realloc_shrink;
+    delta.realloc_moved     = realloc_moved   - before.realloc_moved;
+    delta.bytes_allocated   = bytes_allocated - before.bytes_allocated;
+    for( UInt b=0; b < NUM_BUCKETS; b++ )
+        delta.histogram[b]  = histogram[b] - before.histogram[b];
+    return delta;
+}
+
+UInt MemoryStats::bucket( long size )
+{
+    if( size <= 1 )
+        return 0;
+
+    UInt b = 8*sizeof(unsigned long) - __builtin_clzl( size - 1 );
+    return std::min( b, NUM_BUCKETS - 1 );
+}
+
+
+
+
+PhaseStats::PhaseStats():
+    runs(0),
+    net_bytes(0),
+    max_peak_bytes(0),
+    alloc_calls(0),
+    free_calls(0),
+    realloc_calls(0),
+    bytes_allocated(0)
+{}
+
+void PhaseStats::add( const MemoryStats& delta )
+{
+    ++runs;
+    net_bytes       += delta.live_bytes;
+    max_peak_bytes   = std::max( max_peak_bytes, delta.peak_bytes );
+    alloc_calls     += delta.alloc_calls;
+    free_calls      += delta.free_calls;
+    realloc_calls   += delta.realloc_calls;
+    bytes_allocated += delta.bytes_allocated;
+}
+
+
+
+
+MemoryProfiler::MemoryProfiler()
+{}
+
+void* MemoryProfiler::alloc( long size )
+{
+    Byte* block = (Byte*)std::malloc( HEADER + size );
+    if( !block )
+        return 0;
+
+    size_of(block) = size;
+
+    ++m_stats.alloc_calls;
+    ++m_stats.live_blocks;
+    ++m_stats.histogram[ MemoryStats::bucket(size) ];
+    m_stats.bytes_allocated += size;
+    m_stats.live_bytes      += size;
+    if( m_stats.live_bytes > m_stats.peak_bytes )
+        m_stats.peak_bytes = m_stats.live_bytes;
+
+    return block + HEADER;
+}
+
+void MemoryProfiler::free( void* ptr )
+{
+    ++m_stats.free_calls;
+    if( !ptr )
+        return;
+
+    Byte* block = to_block(ptr);
+    m_stats.live_bytes -= size_of(block);
+    --m_stats.live_blocks;
+    std::free( block );
+}
+
+void* MemoryProfiler::realloc( long cur_size, long new_size, void* ptr )
+{
+    if( !ptr )
+        return alloc( new_size );
+
+    Byte* block     = to_block(ptr);
+    long  old_size  = size_of(block);
+    (void)cur_size;
+
+    Byte* moved = (Byte*)std::realloc( block, HEADER + new_size );
+    if( !moved )
+        return 0;
+
+    size_of(moved) = new_size;
+
+    ++m_stats.realloc_calls;
+    ++m_stats.histogram[ MemoryStats::bucket(new_size) ];
+    if( new_size > old_size )
+    {
+        ++m_stats.realloc_grow;
+        m_stats.bytes_allocated += new_size - old_size;
+    }
+    else if( new_size < old_size )
+        ++m_stats.realloc_shrink;
+    if( moved != block )
+        ++m_stats.realloc_moved;
+
+    m_stats.live_bytes += new_size - old_size;
+    if( m_stats.live_bytes > m_stats.peak_bytes )
+        m_stats.peak_bytes = m_stats.live_bytes;
+
+    return moved + HEADER;
+}
+
+const MemoryStats& MemoryProfiler::stats() const
+{
+    return m_stats;
+}
+
+Long MemoryProfiler::reset_peak()
+{
+    Long peak = m_stats.peak_bytes;
+    m_stats.peak_bytes = m_stats.live_bytes;
+    return peak;
+}
+
+void MemoryProfiler::restore_peak( Long peak )
+{
+    m_stats.peak_bytes = std::max( m_stats.peak_bytes, peak );
+}
+
+void MemoryProfiler::reset_stats()
+{
+    MemoryStats stats;
+    stats.live_bytes    = m_stats.live_bytes;
+    stats.live_blocks   = m_stats.live_blocks;
+    stats.peak_bytes    = m_stats.peak_bytes;
+    m_stats = stats;
+}
+
+MemoryProfiler::PhaseMap_t& MemoryProfiler::phases()
+{
+    return m_phases;
+}
+
+void MemoryProfiler::record( const std::string& name,
+                             const MemoryStats& delta )
+{
+    m_phases[name].add( delta );
+}
+
+
+
+
+MemoryPhase::MemoryPhase( MemoryProfiler& profiler, const char* name ):
+    m_profiler( profiler ),
+    m_name( name ? name : "" )
+{
+    m_outer_peak = m_profiler.reset_peak();
+    m_start      = m_profiler.stats();
+}
+
+MemoryPhase::~MemoryPhase()
+{
+    if( !m_name.empty() )
+        m_profiler.record( m_name, stats() );
+    m_profiler.restore_peak( m_outer_peak );
+}
+
+MemoryStats MemoryPhase::stats() const
+{
+    return m_profiler.stats().since( m_start );
+}
+
+} // namespace freetype
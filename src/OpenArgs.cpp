@@ -26,8 +26,89 @@
 
 #include <cppfreetype/OpenArgs.h>
 
+#include <cstring>
+
 namespace freetype
 {
 
+OpenArgs::OpenArgs()
+{
+    std::memset( &m_args, 0, sizeof(m_args) );
+}
+
+FT_Open_Args* OpenArgs::get_ptr()
+{
+    return &m_args;
+}
+
+const FT_Open_Args* OpenArgs::get_ptr() const
+{
+    return &m_args;
+}
+
+UInt_t& OpenArgs::flags()
+{
+    return m_args.flags;
+}
+
+const Byte_t*& OpenArgs::memory_base()
+{
+    return m_args.memory_base;
+}
+
+Long_t& OpenArgs::memory_size()
+{
+    return m_args.memory_size;
+}
+
+String_t*& OpenArgs::pathname()
+{
+    return m_args.pathname;
+}
+
+FT_Stream& OpenArgs::stream()
+{
+    return m_args.stream;
+}
+
+FT_Module& OpenArgs::driver()
+{
+    return m_args.driver;
+}
+
+Int_t& OpenArgs::num_params()
+{
+    return m_args.num_params;
+}
+
+FT_Parameter*& OpenArgs::params()
+{
+    return m_args.params;
+}
+
+OpenArgs OpenArgs::memory( const Byte_t* base, Long_t size )
+{
+    OpenArgs args;
+    args.flags()        = open_flag::MEMORY;
+    args.memory_base()  = base;
+    args.memory_size()  = size;
+    return args;
+}
+
+OpenArgs OpenArgs::path( const char* filepath )
+{
+    OpenArgs args;
+    args.flags()    = open_flag::PATHNAME;
+    args.pathname() = const_cast<String_t*>(filepath);
+    return args;
+}
+
+OpenArgs OpenArgs::custom_stream( FT_Stream stream )
+{
+    OpenArgs args;
+    args.flags()  = open_flag::STREAM;
+    args.stream() = stream;
+    return args;
+}
 
 } // namespace freetype 
@@ -156,6 +156,15 @@ bool ContourIterator::operator!=( const ContourIterator& other )
     return m_i != other.m_i;
 }
 
+OutlineView::OutlineView():
+    points(0),
+    tags(0),
+    contours(0),
+    n_points(0),
+    n_contours(0),
+    flags(0)
+{}
+
 ContourIterator OutlineDelegate::begin()
 {
     return ContourIterator(m_ptr);
@@ -176,6 +185,18 @@ Short   OutlineDelegate::n_points()   const
     return m_ptr->n_points;
 }
 
+OutlineView OutlineDelegate::view() const
+{
+    OutlineView view;
+    view.points     = m_ptr->points;
+    view.tags       = m_ptr->tags;
+    view.contours   = m_ptr->contours;
+    view.n_points   = m_ptr->n_points;
+    view.n_contours = m_ptr->n_contours;
+    view.flags      = m_ptr->flags;
+    return view;
+}
+
 
 
 
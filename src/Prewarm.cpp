@@ -0,0 +1,432 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/Prewarm.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/Prewarm.h>
+#include <cppfreetype/GlyphSlot.h>
+#include <cppfreetype/MappedFile.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace freetype {
+
+namespace {
+
+inline bool is_separator( char c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ','
+        || c == '#';
+}
+
+/// parse one code, U+hex, 0xhex or decimal, which must fill the whole of
+/// [begin, end)
+bool parse_code( const char* begin, const char* end, ULong& out )
+{
+    UInt base = 10;
+    if( end - begin > 2 && ( begin[0] == 'U' || begin[0] == 'u'
+                            || begin[0] == '0' )
+                        && ( begin[1] == '+' || begin[1] == 'x'
+                            || begin[1] == 'X' ) )
+    {
+        if( ( begin[0] == '0' ) == ( begin[1] == '+' ) )
+            return false;
+        base   = 16;
+        begin += 2;
+    }
+
+    if( begin == end )
+        return false;
+
+    unsigned long long value = 0;
+    for( ; begin < end; ++begin )
+    {
+        char c = *begin;
+        UInt digit;
+        if( c >= '0' && c <= '9' )
+            digit = c - '0';
+        else if( base == 16 && c >= 'a' && c <= 'f' )
+            digit = c - 'a' + 10;
+        else if( base == 16 && c >= 'A' && c <= 'F' )
+            digit = c - 'A' + 10;
+        else
+            return false;
+
+        value = value*base + digit;
+        if( value > 0xFFFFFFFFULL )
+            return false;
+    }
+
+    out = (ULong)value;
+    return true;
+}
+
+/// a glyph rendered by a worker, keyed for the target face
+struct Rendered
+{
+    GlyphKey    key;
+    CachedGlyph glyph;
+};
+
+/// state shared by the workers of one prewarm_e() call
+struct Job
+{
+    LibraryPool*        pool;
+    const UInt*         sizes;
+    const UInt*         glyphs;
+    size_t              n_glyphs;
+    size_t              n_items;    ///< n_sizes * n_glyphs
+    Long                num_glyphs; ///< of the target face
+    FT_Face             target;
+    Int32               load_flags;
+    render_mode::RenderMode mode;
+
+    std::atomic<size_t> next;       ///< first item not yet handed out
+    std::mutex          mutex;      ///< guards error
+    Error               error;
+
+    void fail( Error err )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if( !error )
+            error = err;
+    }
+};
+
+/// items are handed out in chunks so that workers do not contend on the
+/// counter and mostly stay at one size
+const size_t CHUNK = 64;
+
+/// render the items handed out to this worker with its face from the pool
+void render( Job* job, std::vector<Rendered>* out )
+{
+    RefPtr<Face> face;
+    Error        err;
+    (face, err) = job->pool->face_e();
+    if( err )
+    {
+        job->fail( err );
+        return;
+    }
+
+    // a face from a different font would store the wrong bitmaps
+    if( face->num_glyphs() != job->num_glyphs )
+    {
+        job->fail( FT_Err_Invalid_Argument );
+        return;
+    }
+
+    size_t   size_index = job->n_items;     // no size set yet
+    bool     size_ok    = false;
+    GlyphKey base;
+
+    for( ;; )
+    {
+        size_t begin = job->next.fetch_add( CHUNK );
+        if( begin >= job->n_items )
+            break;
+
+        size_t end = std::min( begin + CHUNK, job->n_items );
+        for( size_t item = begin; item < end; item++ )
+        {
+            size_t s = item / job->n_glyphs;
+            if( s != size_index )
+            {
+                size_index = s;
+                err        = face->set_pixel_sizes( 0, job->sizes[s] );
+                size_ok    = !err;
+                if( err )
+                    job->fail( err );
+
+                // the metrics of the worker's face at this size are those
+                // of the target face at the same size
+                base      = GlyphKey::make( face, 0, job->load_flags,
+                                            job->mode );
+                base.face = job->target;
+            }
+
+            if( !size_ok )
+                continue;
+
+            UInt glyph = job->glyphs[ item % job->n_glyphs ];
+            err = face->load_glyph( glyph, job->load_flags );
+            if( err )
+            {
+                job->fail( err );
+                continue;
+            }
+
+            FT_GlyphSlot slot = face.subvert()->glyph;
+            if( slot->format != FT_GLYPH_FORMAT_BITMAP )
+            {
+                err = FT_Render_Glyph( slot, (FT_Render_Mode)job->mode );
+                if( err )
+                {
+                    job->fail( err );
+                    continue;
+                }
+            }
+
+            out->push_back( Rendered() );
+            Rendered& rendered = out->back();
+            rendered.key             = base;
+            rendered.key.glyph_index = glyph;
+            rendered.glyph.assign( RefPtr<GlyphSlot>(slot,true) );
+        }
+    }
+}
+
+/// worker thread entry point, the thread's library goes when it is done
+void work( Job* job, std::vector<Rendered>* out )
+{
+    render( job, out );
+    job->pool->release();
+}
+
+}
+
+Charset::Charset():
+    m_all(false)
+{}
+
+Charset Charset::all()
+{
+    Charset charset;
+    charset.add_all();
+    return charset;
+}
+
+Charset Charset::range( ULong first, ULong last )
+{
+    Charset charset;
+    charset.add( first, last );
+    return charset;
+}
+
+void Charset::add( ULong first, ULong last )
+{
+    if( first <= last )
+        m_ranges.push_back( Range_t(first,last) );
+}
+
+void Charset::add( ULong charcode )
+{
+    add( charcode, charcode );
+}
+
+void Charset::add_all()
+{
+    m_all = true;
+}
+
+Error Charset::load( const char* filepath )
+{
+    RValuePair< MappedFile*, Error > mapped = MappedFile::open( filepath );
+    if( mapped.p2 )
+        return mapped.p2;
+
+    MappedFile* file = mapped.p1;
+    Error       err  = parse( (const char*)file->data(), file->size() );
+    file->release();
+    return err;
+}
+
+Error Charset::parse( const char* text, size_t length )
+{
+    const char* p     = text;
+    const char* limit = text + length;
+
+    while( p < limit )
+    {
+        if( *p == '#' )
+        {
+            while( p < limit && *p != '\n' )
+                ++p;
+            continue;
+        }
+
+        if( is_separator(*p) )
+        {
+            ++p;
+            continue;
+        }
+
+        const char* begin = p;
+        while( p < limit && !is_separator(*p) )
+            ++p;
+
+        // a range is two codes joined by ".." or '-'
+        const char* split = begin;
+        size_t      skip  = 0;
+        for( const char* q = begin + 1; q < p && !skip; q++ )
+        {
+            if( *q == '.' && q + 1 < p && q[1] == '.' )
+                skip = 2;
+            else if( *q == '-' )
+                skip = 1;
+            if( skip )
+                split = q;
+        }
+
+        ULong first;
+        ULong last;
+        if( skip )
+        {
+            if( !parse_code( begin, split, first )
+                    || !parse_code( split + skip, p, last )
+                    || first > last )
+                return FT_Err_Invalid_Argument;
+        }
+        else
+        {
+            if( !parse_code( begin, p, first ) )
+                return FT_Err_Invalid_Argument;
+            last = first;
+        }
+
+        add( first, last );
+    }
+
+    return 0;
+}
+
+const std::vector<Charset::Range_t>& Charset::ranges() const
+{
+    return m_ranges;
+}
+
+bool Charset::is_all() const
+{
+    return m_all;
+}
+
+void Charset::glyphs( RefPtr<Face>& face, std::vector<UInt>& out ) const
+{
+    out.clear();
+
+    if( m_all )
+    {
+        UInt  glyph;
+        ULong charcode = face->get_first_char( glyph );
+        while( glyph )
+        {
+            out.push_back( glyph );
+            charcode = face->get_next_char( charcode, glyph );
+        }
+    }
+
+    for( size_t i=0; i < m_ranges.size(); i++ )
+    {
+        // written so that a range ending at the largest code terminates
+        for( ULong c = m_ranges[i].first; ; c++ )
+        {
+            UInt glyph = face->get_char_index( c );
+            if( glyph )
+                out.push_back( glyph );
+            if( c == m_ranges[i].second )
+                break;
+        }
+    }
+
+    std::sort( out.begin(), out.end() );
+    out.erase( std::unique( out.begin(), out.end() ), out.end() );
+}
+
+RValuePair< size_t, Error > prewarm_e( LibraryPool&    pool,
+                                       RefPtr<Face>&   face,
+                                       const UInt*     sizes,
+                                       size_t          n_sizes,
+                                       const Charset&  charset,
+                                       UInt            threads,
+                                       GlyphCache&     cache,
+                                       Int32           load_flags,
+                                       render_mode::RenderMode mode )
+{
+    typedef RValuePair< size_t, Error > Result_t;
+
+    std::vector<UInt> glyphs;
+    charset.glyphs( face, glyphs );
+    if( glyphs.empty() || !n_sizes )
+        return Result_t( 0, 0 );
+
+    Job job;
+    job.pool       = &pool;
+    job.sizes      = sizes;
+    job.glyphs     = &glyphs[0];
+    job.n_glyphs   = glyphs.size();
+    job.n_items    = n_sizes * glyphs.size();
+    job.num_glyphs = face->num_glyphs();
+    job.target     = face.subvert();
+    job.load_flags = load_flags;
+    job.mode       = mode;
+    job.next       = 0;
+    job.error      = 0;
+
+    if( !threads )
+        threads = std::max( 1U, std::thread::hardware_concurrency() );
+    threads = (UInt)std::min<size_t>( threads,
+                                      ( job.n_items + CHUNK - 1 ) / CHUNK );
+
+    std::vector< std::vector<Rendered> > results( threads );
+    std::vector< std::thread >           workers;
+    workers.reserve( threads );
+    for( UInt i=0; i < threads; i++ )
+        workers.push_back( std::thread( work, &job, &results[i] ) );
+    for( UInt i=0; i < threads; i++ )
+        workers[i].join();
+
+    // only this thread touches the cache
+    size_t inserted = 0;
+    for( UInt i=0; i < threads; i++ )
+    {
+        for( size_t j=0; j < results[i].size(); j++ )
+            cache.insert( results[i][j].key, results[i][j].glyph );
+        inserted += results[i].size();
+        std::vector<Rendered>().swap( results[i] );
+    }
+
+    return Result_t( inserted, job.error );
+}
+
+size_t prewarm( LibraryPool&    pool,
+                RefPtr<Face>&   face,
+                const UInt*     sizes,
+                size_t          n_sizes,
+                const Charset&  charset,
+                UInt            threads,
+                GlyphCache&     cache,
+                Int32           load_flags,
+                render_mode::RenderMode mode )
+{
+    return prewarm_e( pool, face, sizes, n_sizes, charset, threads, cache,
+                      load_flags, mode ).p1;
+}
+
+} // namespace freetype
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/RunCache.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/RunCache.h>
+
+#include <cstring>
+
+namespace freetype {
+
+RunKey::RunKey():
+    face(0),
+    x_ppem(0),
+    y_ppem(0),
+    x_scale(0),
+    y_scale(0),
+    load_flags(0),
+    kerning_mode(0),
+    max_width(0),
+    text(0),
+    length(0),
+    hash(0)
+{}
+
+RunKey RunKey::make( TextLayout& layout,
+                     const char* utf8,
+                     size_t      length,
+                     Pos         max_width )
+{
+    RunKey key;
+    key.face         = layout.face().subvert();
+    key.load_flags   = layout.load_flags();
+    key.kerning_mode = layout.mode();
+    key.max_width    = max_width;
+    key.text         = utf8;
+    key.length       = length;
+
+    if( key.face && key.face->size )
+    {
+        const FT_Size_Metrics& metrics = key.face->size->metrics;
+        key.x_ppem  = metrics.x_ppem;
+        key.y_ppem  = metrics.y_ppem;
+        key.x_scale = metrics.x_scale;
+        key.y_scale = metrics.y_scale;
+    }
+
+    // 64bit FNV-1a over the text and then the fields, folded to size_t
+    unsigned long long h = 14695981039346656037ULL;
+    const Byte* text = (const Byte*)utf8;
+    for( size_t i=0; i < length; i++ )
+    {
+        h ^= text[i];
+        h *= 1099511628211ULL;
+    }
+
+    const unsigned long long words[] =
+    {
+        (unsigned long long)(size_t)key.face,
+        ((unsigned long long)key.x_ppem << 16) | key.y_ppem,
+        (unsigned long long)key.x_scale,
+        (unsigned long long)key.y_scale,
+        (unsigned long long)(UInt32)key.load_flags,
+        (unsigned long long)key.kerning_mode,
+        (unsigned long long)key.max_width,
+        (unsigned long long)length
+    };
+
+    for( unsigned int i=0; i < sizeof(words)/sizeof(words[0]); i++ )
+    {
+        h ^= words[i];
+        h *= 1099511628211ULL;
+    }
+
+    key.hash = (size_t)( h ^ ( h >> 32 ) );
+    return key;
+}
+
+bool RunKey::operator==( const RunKey& other ) const
+{
+    return hash         == other.hash
+        && face         == other.face
+        && x_ppem       == other.x_ppem
+        && y_ppem       == other.y_ppem
+        && x_scale      == other.x_scale
+        && y_scale      == other.y_scale
+        && load_flags   == other.load_flags
+        && kerning_mode == other.kerning_mode
+        && max_width    == other.max_width
+        && length       == other.length
+        && ( length == 0 || std::memcmp( text, other.text, length ) == 0 );
+}
+
+size_t RunKeyHash::operator()( const RunKey& key ) const
+{
+    return key.hash;
+}
+
+size_t CachedRun::bytes() const
+{
+    return text.capacity() + run.bytes();
+}
+
+namespace {
+
+/// matches the keys of the runs laid out with one face
+struct SameFace
+{
+    FT_Face face;
+
+    bool operator()( const RunKey& key ) const
+    {
+        return key.face == face;
+    }
+};
+
+}
+
+RunCache::RunCache( size_t budget ):
+    Lru_t(budget)
+{}
+
+const GlyphRun* RunCache::lookup( TextLayout& layout,
+                                  const char* utf8,
+                                  size_t      length,
+                                  Pos         max_width )
+{
+    return lookup_e( layout, utf8, length, max_width ).p1;
+}
+
+const GlyphRun* RunCache::lookup( TextLayout& layout,
+                                  const char* utf8,
+                                  Pos         max_width )
+{
+    return lookup_e( layout, utf8, std::strlen(utf8), max_width ).p1;
+}
+
+RValuePair< const GlyphRun*, Error > RunCache::lookup_e(
+                                  TextLayout& layout,
+                                  const char* utf8,
+                                  size_t      length,
+                                  Pos         max_width )
+{
+    typedef RValuePair< const GlyphRun*, Error > Result_t;
+
+    RunKey key = RunKey::make( layout, utf8, length, max_width );
+
+    const CachedRun* found = find(key);
+    if( found )
+        return Result_t( &found->run, 0 );
+
+    // lay out straight into the new entry at the front of the list
+    Lru_t::Entry& entry = prepare(key);
+    Error err = layout.layout( utf8, length, entry.value.run, max_width );
+    if( err )
+    {
+        discard();
+        return Result_t( 0, err );
+    }
+
+    // the stored key refers to the entry's own copy of the text
+    entry.value.text.assign( utf8, length );
+    entry.key.text = entry.value.text.data();
+    commit();
+
+    return Result_t( &entry.value.run, 0 );
+}
+
+void RunCache::purge( RefPtr<Face>& face )
+{
+    SameFace match = { face.subvert() };
+    erase_if( match );
+}
+
+} // namespace freetype
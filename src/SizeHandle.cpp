@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/SizeHandle.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/SizeHandle.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_SIZES_H
+
+namespace freetype {
+
+SizeHandle::SizeHandle():
+    m_size(0)
+{}
+
+SizeHandle::~SizeHandle()
+{
+    release();
+}
+
+Error SizeHandle::create( RefPtr<Face>& face )
+{
+    release();
+
+    FT_Size size = 0;
+    Error   err  = FT_New_Size( face.subvert(), &size );
+    if( err )
+        return err;
+
+    m_face = face;
+    m_size = size;
+    return 0;
+}
+
+void SizeHandle::release()
+{
+    // the size must go before the face it belongs to
+    if( m_size )
+        FT_Done_Size( m_size );
+    m_size = 0;
+    m_face.unlink();
+}
+
+Error SizeHandle::activate()
+{
+    if( !m_size )
+        return FT_Err_Invalid_Size_Handle;
+    return FT_Activate_Size( m_size );
+}
+
+bool SizeHandle::is_active() const
+{
+    return m_size && m_size->face->size == m_size;
+}
+
+Error SizeHandle::set_char_size( F26Dot6 char_width,
+                                 F26Dot6 char_height,
+                                 UInt    horz_resolution,
+                                 UInt    vert_resolution )
+{
+    Error err = activate();
+    if( err )
+        return err;
+    return m_face->set_char_size( char_width, char_height,
+                                  horz_resolution, vert_resolution );
+}
+
+Error SizeHandle::set_pixel_sizes( UInt pixel_width, UInt pixel_height )
+{
+    Error err = activate();
+    if( err )
+        return err;
+    return m_face->set_pixel_sizes( pixel_width, pixel_height );
+}
+
+const FT_Size_Metrics& SizeHandle::metrics() const
+{
+    return m_size->metrics;
+}
+
+RefPtr<Face>& SizeHandle::face()
+{
+    return m_face;
+}
+
+bool SizeHandle::is_valid() const
+{
+    return m_size;
+}
+
+} // namespace freetype
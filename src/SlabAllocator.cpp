@@ -0,0 +1,236 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/SlabAllocator.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/SlabAllocator.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace freetype {
+
+namespace {
+
+/// every block is preceded by a header holding its size class, the header
+/// is as large as the alignment malloc guarantees
+const size_t HEADER = 16;
+
+/// size class marker for blocks which came from the C library
+const Byte LARGE = 0xFF;
+
+const UInt CLASS_SIZE[ SlabAllocator::NUM_CLASSES ] =
+{
+      16,   32,   48,   64,   96,  128,  192,  256,
+     384,  512,  768, 1024, 1536, 2048, 3072, 4096
+};
+
+}
+
+SlabAllocator::Stats::Stats():
+    alloc_calls(0),
+    free_calls(0),
+    realloc_calls(0),
+    system_calls(0),
+    live_blocks(0),
+    reserved_bytes(0)
+{}
+
+Byte* SlabAllocator::bump( UInt c )
+{
+    size_t need = HEADER + CLASS_SIZE[c];
+    while( (size_t)(m_end - m_cursor) < need )
+    {
+        // move on to the next chunk, reusing the ones kept by reset()
+        if( m_chunks.empty() || m_chunk + 1 >= m_chunks.size() )
+        {
+            Byte* chunk = (Byte*)std::malloc( m_chunk_size );
+            ++m_stats.system_calls;
+            if( !chunk )
+                return 0;
+            m_chunks.push_back( chunk );
+            m_stats.reserved_bytes += m_chunk_size;
+            m_chunk = m_chunks.size() - 1;
+        }
+        else
+            ++m_chunk;
+
+        m_cursor = m_chunks[m_chunk];
+        m_end    = m_cursor + m_chunk_size;
+    }
+
+    Byte* block = m_cursor;
+    m_cursor   += need;
+    return block;
+}
+
+SlabAllocator::SlabAllocator( size_t chunk_size ):
+    m_chunk_size( std::max<size_t>( chunk_size, HEADER + MAX_SMALL ) ),
+    m_chunk(0),
+    m_cursor(0),
+    m_end(0)
+{
+    for( UInt c=0; c < NUM_CLASSES; c++ )
+        m_free[c] = 0;
+
+    // m_class[i] is the smallest class holding 16*i bytes
+    UInt c = 0;
+    for( UInt i=0; i <= MAX_SMALL/16; i++ )
+    {
+        while( CLASS_SIZE[c] < 16*i )
+            c++;
+        m_class[i] = c;
+    }
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    for( size_t i=0; i < m_chunks.size(); i++ )
+        std::free( m_chunks[i] );
+}
+
+void* SlabAllocator::alloc( long size )
+{
+    ++m_stats.alloc_calls;
+
+    Byte* block = 0;
+    Byte  c     = LARGE;
+    if( size <= (long)MAX_SMALL )
+    {
+        c = m_class[ (size + 15) >> 4 ];
+        if( m_free[c] )
+        {
+            block     = (Byte*)m_free[c] - HEADER;
+            m_free[c] = m_free[c]->next;
+        }
+        else
+            block = bump(c);
+    }
+    else
+    {
+        block = (Byte*)std::malloc( HEADER + size );
+        ++m_stats.system_calls;
+    }
+
+    if( !block )
+        return 0;
+
+    block[0] = c;
+    ++m_stats.live_blocks;
+    return block + HEADER;
+}
+
+void SlabAllocator::free( void* ptr )
+{
+    ++m_stats.free_calls;
+    if( !ptr )
+        return;
+
+    Byte* block = (Byte*)ptr - HEADER;
+    Byte  c     = block[0];
+    --m_stats.live_blocks;
+
+    if( c == LARGE )
+    {
+        std::free( block );
+        ++m_stats.system_calls;
+        return;
+    }
+
+    FreeBlock* node = (FreeBlock*)ptr;
+    node->next  = m_free[c];
+    m_free[c]   = node;
+}
+
+void* SlabAllocator::realloc( long cur_size, long new_size, void* ptr )
+{
+    ++m_stats.realloc_calls;
+    if( !ptr )
+        return alloc( new_size );
+
+    Byte* block = (Byte*)ptr - HEADER;
+    Byte  c     = block[0];
+
+    if( c == LARGE && new_size > (long)MAX_SMALL )
+    {
+        block = (Byte*)std::realloc( block, HEADER + new_size );
+        ++m_stats.system_calls;
+        return block ? block + HEADER : 0;
+    }
+
+    // still fits in the same slab block
+    if( c != LARGE && new_size <= (long)CLASS_SIZE[c]
+                   && new_size > (long)CLASS_SIZE[c] / 2 )
+        return ptr;
+
+    void* moved = alloc( new_size );
+    --m_stats.alloc_calls;
+    if( !moved )
+        return 0;
+
+    std::memcpy( moved, ptr, std::min( cur_size, new_size ) );
+    free( ptr );
+    --m_stats.free_calls;
+    return moved;
+}
+
+bool SlabAllocator::reset()
+{
+    if( m_stats.live_blocks )
+        return false;
+
+    for( UInt c=0; c < NUM_CLASSES; c++ )
+        m_free[c] = 0;
+
+    m_chunk = 0;
+    if( m_chunks.empty() )
+        m_cursor = m_end = 0;
+    else
+    {
+        m_cursor = m_chunks[0];
+        m_end    = m_cursor + m_chunk_size;
+    }
+    return true;
+}
+
+const SlabAllocator::Stats& SlabAllocator::stats() const
+{
+    return m_stats;
+}
+
+void SlabAllocator::reset_stats()
+{
+    Stats stats;
+    stats.live_blocks    = m_stats.live_blocks;
+    stats.reserved_bytes = m_stats.reserved_bytes;
+    m_stats = stats;
+}
+
+UInt SlabAllocator::class_size( UInt c )
+{
+    return CLASS_SIZE[c];
+}
+
+} // namespace freetype
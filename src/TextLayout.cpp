@@ -0,0 +1,326 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   src/TextLayout.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include <cppfreetype/TextLayout.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <algorithm>
+#include <cstring>
+
+namespace freetype {
+
+namespace {
+
+const UInt32 REPLACEMENT = 0xFFFD;
+
+inline bool is_space( UInt32 c )
+{
+    return c == ' ' || c == '\t' || c == 0x3000;
+}
+
+}
+
+UInt32 decode_utf8( const Byte* text, size_t length, size_t& i )
+{
+    UInt32 c = text[i++];
+    if( c < 0x80 )
+        return c;
+
+    UInt   extra;
+    UInt32 min;
+    if( ( c & 0xE0 ) == 0xC0 )
+    {
+        extra = 1;
+        min   = 0x80;
+        c    &= 0x1F;
+    }
+    else if( ( c & 0xF0 ) == 0xE0 )
+    {
+        extra = 2;
+        min   = 0x800;
+        c    &= 0x0F;
+    }
+    else if( ( c & 0xF8 ) == 0xF0 )
+    {
+        extra = 3;
+        min   = 0x10000;
+        c    &= 0x07;
+    }
+    else
+        return REPLACEMENT;
+
+    for( UInt k=0; k < extra; k++ )
+    {
+        // a truncated sequence, resume at the offending byte
+        if( i >= length || ( text[i] & 0xC0 ) != 0x80 )
+            return REPLACEMENT;
+        c = ( c << 6 ) | ( text[i++] & 0x3F );
+    }
+
+    // overlong encodings, surrogates and values past Unicode
+    if( c < min || c > 0x10FFFF || ( c >= 0xD800 && c <= 0xDFFF ) )
+        return REPLACEMENT;
+    return c;
+}
+
+GlyphRun::GlyphRun():
+    width(0),
+    height(0),
+    ascender(0),
+    descender(0),
+    line_height(0)
+{}
+
+void GlyphRun::clear()
+{
+    glyphs.clear();
+    x.clear();
+    y.clear();
+    clusters.clear();
+    line_ends.clear();
+    width       = 0;
+    height      = 0;
+    ascender    = 0;
+    descender   = 0;
+    line_height = 0;
+}
+
+size_t GlyphRun::size() const
+{
+    return glyphs.size();
+}
+
+size_t GlyphRun::n_lines() const
+{
+    return line_ends.size();
+}
+
+FT_BBox GlyphRun::bbox() const
+{
+    FT_BBox box;
+    box.xMin = 0;
+    box.yMin = 0;
+    box.xMax = width;
+    box.yMax = height;
+    return box;
+}
+
+size_t GlyphRun::bytes() const
+{
+    return glyphs.capacity()    * sizeof(UInt)
+         + x.capacity()         * sizeof(Pos)
+         + y.capacity()         * sizeof(Pos)
+         + clusters.capacity()  * sizeof(UInt)
+         + line_ends.capacity() * sizeof(UInt);
+}
+
+TextLayout::TextLayout( RefPtr<Face>& face,
+                        Int32 load_flags,
+                        kerning_mode::KerningMode mode ):
+    m_face(face),
+    m_advances(face, load_flags),
+    m_kerning_mode(mode),
+    m_kern_table(false),
+    m_kern_query(false),
+    m_x_scale(0)
+{
+    rebuild();
+}
+
+void TextLayout::rebuild()
+{
+    m_charmap.build( m_face );
+
+    m_kerning.clear();
+    m_kern_table = false;
+    m_kern_query = false;
+    m_x_scale    = 0;
+    if( m_face->has_kerning() )
+    {
+        m_kern_table = ( m_kerning.build( m_face ) == 0 );
+        m_kern_query = !m_kern_table;
+    }
+}
+
+RefPtr<Face> TextLayout::face()
+{
+    return m_face;
+}
+
+Int32 TextLayout::load_flags() const
+{
+    return m_advances.load_flags();
+}
+
+kerning_mode::KerningMode TextLayout::mode() const
+{
+    return m_kerning_mode;
+}
+
+Pos TextLayout::kerning( UInt left, UInt right )
+{
+    if( m_kern_table )
+        return m_kerning.get( left, right );
+
+    FT_Vector kern;
+    if( FT_Get_Kerning( m_face.subvert(), left, right, m_kerning_mode,
+                        &kern ) )
+        return 0;
+    return kern.x;
+}
+
+Error TextLayout::layout( const char* utf8, GlyphRun& run, Pos max_width )
+{
+    return layout( utf8, std::strlen(utf8), run, max_width );
+}
+
+Error TextLayout::layout( const char* utf8, size_t length, GlyphRun& run,
+                          Pos max_width )
+{
+    run.clear();
+
+    // report only the errors of this layout
+    m_advances.clear_error();
+
+    FT_Face face = m_face.subvert();
+    if( face->size )
+    {
+        const FT_Size_Metrics& metrics = face->size->metrics;
+        if( FT_IS_SCALABLE(face) )
+        {
+            run.ascender    = FT_MulFix( face->ascender,  metrics.y_scale );
+            run.descender   = FT_MulFix( face->descender, metrics.y_scale );
+            run.line_height = FT_MulFix( face->height,    metrics.y_scale );
+        }
+        else
+        {
+            run.ascender    = metrics.ascender;
+            run.descender   = metrics.descender;
+            run.line_height = metrics.height;
+        }
+
+        if( m_kern_table && metrics.x_scale != m_x_scale )
+        {
+            m_kerning.scale( m_face, m_kerning_mode );
+            m_x_scale = metrics.x_scale;
+        }
+    }
+
+    bool        kern     = m_kern_table || m_kern_query;
+    const Byte* text     = (const Byte*)utf8;
+    Pos         baseline = run.ascender;
+    Pos         pen      = 0;
+    Pos         ink_end  = 0;   ///< pen after the last non-space glyph
+    size_t      start    = 0;   ///< first glyph of the line
+    size_t      wrap     = 0;   ///< first glyph after the last space, or 0
+    Pos         wrap_ink = 0;   ///< ink_end when that space was reached
+    UInt        prev     = 0;
+
+    for( size_t i=0; i < length; )
+    {
+        UInt   cluster = i;
+        UInt32 c       = decode_utf8( text, length, i );
+
+        if( c == '\n' )
+        {
+            run.line_ends.push_back( run.glyphs.size() );
+            run.width = std::max( run.width, ink_end );
+            baseline += run.line_height;
+            pen       = 0;
+            ink_end   = 0;
+            start     = run.glyphs.size();
+            wrap      = 0;
+            prev      = 0;
+            continue;
+        }
+
+        UInt glyph = m_charmap.lookup( c );
+        if( kern && prev )
+            pen += kerning( prev, glyph );
+
+        Pos  advance = m_advances.advance( glyph );
+        bool space   = is_space(c);
+
+        if( max_width > 0 && !space && pen + advance > max_width
+                && run.glyphs.size() > start )
+        {
+            if( wrap > start )
+            {
+                // move the glyphs after the last space to a new line
+                Pos shift = wrap < run.glyphs.size() ? run.x[wrap] : pen;
+                run.line_ends.push_back( wrap );
+                run.width = std::max( run.width, wrap_ink );
+                baseline += run.line_height;
+                for( size_t k=wrap; k < run.glyphs.size(); k++ )
+                {
+                    run.x[k] -= shift;
+                    run.y[k]  = baseline;
+                }
+                pen    -= shift;
+                ink_end = run.glyphs.size() > wrap ? ink_end - shift : 0;
+                start   = wrap;
+            }
+            else
+            {
+                // no space on this line, break before this glyph
+                run.line_ends.push_back( run.glyphs.size() );
+                run.width = std::max( run.width, ink_end );
+                baseline += run.line_height;
+                pen       = 0;
+                ink_end   = 0;
+                start     = run.glyphs.size();
+            }
+            wrap = 0;
+        }
+
+        run.glyphs.push_back( glyph );
+        run.x.push_back( pen );
+        run.y.push_back( baseline );
+        run.clusters.push_back( cluster );
+        pen += advance;
+
+        if( space )
+        {
+            wrap     = run.glyphs.size();
+            wrap_ink = ink_end;
+        }
+        else
+            ink_end = pen;
+
+        prev = glyph;
+    }
+
+    run.line_ends.push_back( run.glyphs.size() );
+    run.width  = std::max( run.width, ink_end );
+    run.height = run.ascender - run.descender
+               + (Pos)( run.line_ends.size() - 1 ) * run.line_height;
+
+    return m_advances.error();
+}
+
+} // namespace freetype
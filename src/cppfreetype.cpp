@@ -50,11 +50,11 @@ namespace freetype
     /// initialize freetype, returns error code as well
     RValuePair< RefPtr<Library>, Error > init_e()
     {
-        FT_Library ptr;
+        FT_Library ptr = 0;
         Error      err = FT_Init_FreeType(&ptr);
 
         RValuePair< RefPtr<Library>, Error > pair
-            ( RefPtr<Library>(ptr), err );
+            ( RefPtr<Library>( err ? 0 : ptr, !err ), err );
 
         // give an extra reference count which we'llt ake away in the
         // done functoin
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/Atlas.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include "bench.h"
+
+#include <cstdio>
+
+namespace bench {
+
+using namespace freetype;
+
+int atlas( const char* filepath )
+{
+    RefPtr<Library> library;
+    Error           err;
+    (library, err) = init_e();
+    if( err )
+        return err;
+
+    // render once up front so that only the packing is timed
+    std::vector<CachedGlyph> glyphs;
+    {
+        RefPtr<Face> face;
+        (face, err) = library->new_face_e( filepath, 0 );
+        if( err )
+        {
+            done( library );
+            return err;
+        }
+
+        std::vector<UInt> indices;
+        mapped_glyphs( face, indices );
+
+        const UInt sizes[] = { 12, 16, 24, 32 };
+        for( UInt s=0; s < sizeof(sizes)/sizeof(sizes[0]); s++ )
+        {
+            face->set_pixel_sizes( 0, sizes[s] );
+            for( size_t i=0; i < indices.size(); i++ )
+            {
+                if( face->load_glyph( indices[i], load::RENDER ) )
+                    continue;
+                glyphs.push_back( CachedGlyph() );
+                glyphs.back().assign( face->glyph() );
+            }
+        }
+    }
+    done( library );
+
+    const UInt page_sizes[] = { 256, 512, 1024, 2048 };
+    for( UInt p=0; p < sizeof(page_sizes)/sizeof(page_sizes[0]); p++ )
+    {
+        GlyphAtlas atlas( page_sizes[p], page_sizes[p] );
+        AtlasGlyph out;
+        size_t     packed = 0;
+        double     start  = now();
+        double     end    = start;
+
+        // repeat for at least a quarter second
+        while( end - start < 0.25 )
+        {
+            atlas.clear();
+            for( size_t i=0; i < glyphs.size(); i++ )
+                packed += atlas.insert( glyphs[i], out );
+            end = now();
+        }
+
+        std::printf( "  %4ux%-4u  %6zu glyphs  %4u pages  %5.1f%% used  "
+                     "%7.2f M glyphs/s\n",
+                     page_sizes[p], page_sizes[p], glyphs.size(),
+                     atlas.num_pages(), 100 * atlas.efficiency(),
+                     packed / ( end - start ) / 1e6 );
+    }
+
+    return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/Batch.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "bench.h"
+
+#include <cstdio>
+
+namespace bench {
+
+using namespace freetype;
+
+namespace {
+
+/// a paragraph of ordinary text, glyphs repeat the way they do in prose
+const char PARAGRAPH[] =
+    "The quick brown fox jumps over the lazy dog while the five boxing "
+    "wizards jump quickly. Pack my box with five dozen liquor jugs, and "
+    "how vexingly quick daft zebras jump when sphinx of black quartz "
+    "judges my vow.";
+
+const int PASSES = 200;
+
+}
+
+int batch( const char* filepath )
+{
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    if( err )
+        return err;
+
+    (face, err) = library->new_face_e( filepath, 0 );
+    if( !err )
+        err = face->set_pixel_sizes( 0, 16 );
+    if( err )
+    {
+        face.unlink();
+        done( library );
+        return err;
+    }
+
+    std::vector<UInt> glyphs;
+    for( const char* c = PARAGRAPH; *c; ++c )
+        glyphs.push_back( face->get_char_index( (Byte)*c ) );
+
+    const double n_glyphs = (double)glyphs.size() * PASSES;
+
+    // one CachedGlyph per request, the way a caller without batches keeps
+    // the images of a run
+    std::vector<CachedGlyph> copies( glyphs.size() );
+    double start = now();
+    for( int p=0; p < PASSES && !err; p++ )
+    {
+        for( size_t i=0; i < glyphs.size() && !err; i++ )
+        {
+            err = face->load_glyph( glyphs[i], load::RENDER );
+            if( !err )
+                copies[i].assign( face->glyph() );
+        }
+    }
+    double rate = n_glyphs / ( now() - start );
+    if( !err )
+        std::printf( "  load_glyph   %9.0f glyphs/s\n", rate );
+
+    GlyphBatch batch;
+    start = now();
+    for( int p=0; p < PASSES && !err; p++ )
+        err = face->load_glyphs( &glyphs[0], glyphs.size(), load::RENDER,
+                                 batch );
+    rate = n_glyphs / ( now() - start );
+    if( !err )
+        std::printf( "  load_glyphs  %9.0f glyphs/s  %7.1f%% duplicates\n",
+                     rate, 100.0 * batch.duplicates / glyphs.size() );
+
+    face.unlink();
+    done( library );
+    return err;
+}
+
+} // namespace bench
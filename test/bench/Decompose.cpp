@@ -0,0 +1,226 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/Decompose.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "bench.h"
+
+#include <cstdio>
+
+#include <ft2build.h>
+#include FT_OUTLINE_H
+
+namespace bench {
+
+using namespace freetype;
+
+namespace {
+
+/// decompose() visitor which sums the coordinates it is given, so the
+/// walk can not be optimized away
+struct Summer
+{
+    Long    sum;
+    ULong   segments;
+
+    Summer():
+        sum(0),
+        segments(0)
+    {}
+
+    Error move_to( const FT_Vector& to )
+    {
+        sum += to.x + to.y;
+        return 0;
+    }
+
+    Error line_to( const FT_Vector& to )
+    {
+        sum += to.x + to.y;
+        ++segments;
+        return 0;
+    }
+
+    Error conic_to( const FT_Vector& control, const FT_Vector& to )
+    {
+        sum += control.x + to.x + to.y;
+        ++segments;
+        return 0;
+    }
+
+    Error cubic_to( const FT_Vector& control1, const FT_Vector& control2,
+                    const FT_Vector& to )
+    {
+        sum += control1.x + control2.x + to.x + to.y;
+        ++segments;
+        return 0;
+    }
+};
+
+// the same visitor as FT_Outline_Decompose callbacks
+
+int ft_move_to( const FT_Vector* to, void* user )
+{
+    return ((Summer*)user)->move_to( *to );
+}
+
+int ft_line_to( const FT_Vector* to, void* user )
+{
+    return ((Summer*)user)->line_to( *to );
+}
+
+int ft_conic_to( const FT_Vector* control, const FT_Vector* to,
+                 void* user )
+{
+    return ((Summer*)user)->conic_to( *control, *to );
+}
+
+int ft_cubic_to( const FT_Vector* control1, const FT_Vector* control2,
+                 const FT_Vector* to, void* user )
+{
+    return ((Summer*)user)->cubic_to( *control1, *control2, *to );
+}
+
+/// an FT_Outline over the arrays of @p view, for the FreeType and iterator
+/// walks, neither of which writes to the outline
+FT_Outline as_outline( const OutlineView& view )
+{
+    FT_Outline outline;
+    outline.n_contours = view.n_contours;
+    outline.n_points   = view.n_points;
+    outline.points     = const_cast<FT_Vector*>( view.points );
+    outline.tags       = const_cast<char*>( view.tags );
+    outline.contours   = const_cast<Short*>( view.contours );
+    outline.flags      = view.flags;
+    return outline;
+}
+
+const int PASSES = 20;
+
+}
+
+int decompose( const char* filepath )
+{
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    if( err )
+        return err;
+
+    (face, err) = library->new_face_e( filepath, 0 );
+    if( err )
+    {
+        done( library );
+        return err;
+    }
+
+    // keep every outline of the face in one batch so that only the walks
+    // are timed
+    std::vector<UInt> glyphs;
+    GlyphBatch        batch;
+    mapped_glyphs( face, glyphs );
+    face->load_glyphs( glyphs.empty() ? 0 : &glyphs[0], glyphs.size(),
+                       load::NO_SCALE, batch );
+
+    std::vector<OutlineView> outlines;
+    for( size_t i=0; i < batch.glyphs.size(); i++ )
+    {
+        const BatchGlyph& glyph = batch.glyphs[i];
+        if( !glyph.error && glyph.format == FT_GLYPH_FORMAT_OUTLINE )
+            outlines.push_back( batch.outline( glyph ) );
+    }
+
+    face.unlink();
+    done( library );
+
+    if( outlines.empty() )
+        return 1;
+
+    const double n_glyphs = (double)outlines.size() * PASSES;
+
+    Summer  visitor;
+    double  start = now();
+    for( int p=0; p < PASSES; p++ )
+    {
+        for( size_t i=0; i < outlines.size(); i++ )
+        {
+            if( freetype::decompose( outlines[i], visitor ) )
+                return 1;
+        }
+    }
+    double rate = n_glyphs / ( now() - start );
+    std::printf( "  decompose()           %9.0f glyphs/s  %7.1f segments/glyph"
+                 "  (%ld)\n", rate, visitor.segments / n_glyphs, visitor.sum );
+
+    FT_Outline_Funcs funcs;
+    funcs.move_to  = &ft_move_to;
+    funcs.line_to  = &ft_line_to;
+    funcs.conic_to = &ft_conic_to;
+    funcs.cubic_to = &ft_cubic_to;
+    funcs.shift    = 0;
+    funcs.delta    = 0;
+
+    Summer ft_visitor;
+    start = now();
+    for( int p=0; p < PASSES; p++ )
+    {
+        for( size_t i=0; i < outlines.size(); i++ )
+        {
+            FT_Outline outline = as_outline( outlines[i] );
+            if( FT_Outline_Decompose( &outline, &funcs, &ft_visitor ) )
+                return 1;
+        }
+    }
+    rate = n_glyphs / ( now() - start );
+    std::printf( "  FT_Outline_Decompose  %9.0f glyphs/s  %7.1f segments/glyph"
+                 "  (%ld)\n", rate, ft_visitor.segments / n_glyphs,
+                 ft_visitor.sum );
+
+    // the iterators only read each point, any decomposition built on them
+    // costs at least this much
+    Long sum = 0;
+    start = now();
+    for( int p=0; p < PASSES; p++ )
+    {
+        for( size_t i=0; i < outlines.size(); i++ )
+        {
+            FT_Outline outline = as_outline( outlines[i] );
+            for( ContourIterator ic( &outline ); !ic.done(); ++ic )
+            {
+                for( PointIterator ip = ic->begin(); ip != ic->end(); ++ip )
+                {
+                    if( ip->on() || ip->conic() )
+                        sum += ip->x() + ip->y();
+                }
+            }
+        }
+    }
+    rate = n_glyphs / ( now() - start );
+    std::printf( "  iterators, read only  %9.0f glyphs/s  (%ld)\n",
+                 rate, sum );
+
+    return 0;
+}
+
+} // namespace bench
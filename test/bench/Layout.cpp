@@ -0,0 +1,199 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/Layout.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "bench.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace bench {
+
+using namespace freetype;
+
+namespace {
+
+/// short labels and a longer line, the kind of text a user interface lays
+/// out every frame
+const char* const TEXTS[] =
+{
+    "File",
+    "Edit",
+    "Preferences",
+    "Save changes before closing?",
+    "The quick brown fox jumps over the lazy dog while the five boxing "
+    "wizards jump quickly.",
+    "Zoom: 100%",
+    "AVAWAY Ty To",
+};
+
+const size_t NUM_TEXTS = sizeof(TEXTS) / sizeof(TEXTS[0]);
+
+const int PASSES = 2000;
+
+/// the pen walk a caller writes without TextLayout: map, load and kern
+/// every character, ascii only
+Error walk( RefPtr<Face>& face, const char* text, GlyphRun& run )
+{
+    run.clear();
+
+    FT_Face ptr  = face.subvert();
+    Pos     x    = 0;
+    UInt    prev = 0;
+    for( const char* c = text; *c; ++c )
+    {
+        UInt  glyph = FT_Get_Char_Index( ptr, (Byte)*c );
+        Error err   = FT_Load_Glyph( ptr, glyph, FT_LOAD_NO_HINTING );
+        if( err )
+            return err;
+
+        if( prev )
+        {
+            FT_Vector kern;
+            FT_Get_Kerning( ptr, prev, glyph, FT_KERNING_UNFITTED, &kern );
+            x += kern.x;
+        }
+
+        run.glyphs.push_back( glyph );
+        run.x.push_back( x );
+        x   += ptr->glyph->advance.x;
+        prev = glyph;
+    }
+
+    return 0;
+}
+
+}
+
+int layout( const char* filepath )
+{
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    if( err )
+        return err;
+
+    (face, err) = library->new_face_e( filepath, 0 );
+    if( !err )
+        err = face->set_pixel_sizes( 0, 16 );
+    if( err )
+    {
+        face.unlink();
+        done( library );
+        return err;
+    }
+
+    size_t n_chars = 0;
+    for( size_t t=0; t < NUM_TEXTS; t++ )
+        n_chars += std::strlen( TEXTS[t] );
+    const double n_total = (double)n_chars * PASSES;
+
+    GlyphRun run;
+    double   start = now();
+    for( int p=0; p < PASSES && !err; p++ )
+    {
+        for( size_t t=0; t < NUM_TEXTS && !err; t++ )
+            err = walk( face, TEXTS[t], run );
+    }
+    double rate = n_total / ( now() - start );
+    if( !err )
+        std::printf( "  load_glyph walk  %10.0f chars/s\n", rate );
+
+    {
+        TextLayout text_layout( face );
+        start = now();
+        for( int p=0; p < PASSES && !err; p++ )
+        {
+            for( size_t t=0; t < NUM_TEXTS && !err; t++ )
+                err = text_layout.layout( TEXTS[t], run );
+        }
+        rate = n_total / ( now() - start );
+        if( !err )
+            std::printf( "  TextLayout       %10.0f chars/s\n", rate );
+    }
+
+    face.unlink();
+    done( library );
+    return err;
+}
+
+int runcache( const char* filepath )
+{
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    if( err )
+        return err;
+
+    (face, err) = library->new_face_e( filepath, 0 );
+    if( !err )
+        err = face->set_pixel_sizes( 0, 16 );
+    if( err )
+    {
+        face.unlink();
+        done( library );
+        return err;
+    }
+
+    const double n_total = (double)NUM_TEXTS * PASSES;
+
+    {
+        TextLayout  text_layout( face );
+        GlyphRun    run;
+        double      start = now();
+        for( int p=0; p < PASSES && !err; p++ )
+        {
+            for( size_t t=0; t < NUM_TEXTS && !err; t++ )
+                err = text_layout.layout( TEXTS[t], run );
+        }
+        double rate = n_total / ( now() - start );
+        if( !err )
+            std::printf( "  TextLayout  %10.0f strings/s\n", rate );
+
+        RunCache cache;
+        start = now();
+        for( int p=0; p < PASSES && !err; p++ )
+        {
+            for( size_t t=0; t < NUM_TEXTS && !err; t++ )
+            {
+                if( !cache.lookup( text_layout, TEXTS[t] ) )
+                    err = 1;
+            }
+        }
+        rate = n_total / ( now() - start );
+        if( !err )
+            std::printf( "  RunCache    %10.0f strings/s  %lu hits  "
+                         "%lu misses\n", rate, cache.stats().hits,
+                         cache.stats().misses );
+        cache.purge( face );
+    }
+
+    face.unlink();
+    done( library );
+    return err;
+}
+
+} // namespace bench
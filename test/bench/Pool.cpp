@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/Pool.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+namespace bench {
+
+using namespace freetype;
+
+namespace {
+
+/// work shared by the threads of one run
+struct PoolJob
+{
+    LibraryPool*                pool;
+    const std::vector<UInt>*    glyphs;
+    size_t                      n_items;    ///< passes * glyphs
+    std::atomic<size_t>         next;       ///< first item not handed out
+    std::atomic<size_t>         failed;
+};
+
+/// items are handed out in chunks so that the threads do not contend on
+/// the counter
+const size_t CHUNK = 64;
+
+void render( PoolJob* job )
+{
+    RefPtr<Face> face = job->pool->face();
+    if( !face )
+    {
+        ++job->failed;
+        return;
+    }
+    face->set_pixel_sizes( 0, 16 );
+
+    const std::vector<UInt>& glyphs = *job->glyphs;
+    for( ;; )
+    {
+        size_t begin = job->next.fetch_add( CHUNK );
+        if( begin >= job->n_items )
+            break;
+
+        size_t end = std::min( begin + CHUNK, job->n_items );
+        for( size_t item = begin; item < end; item++ )
+        {
+            if( face->load_glyph( glyphs[ item % glyphs.size() ],
+                                  load::RENDER ) )
+                ++job->failed;
+        }
+    }
+
+    face.unlink();
+    job->pool->release();
+}
+
+}
+
+int pool( const char* filepath )
+{
+    std::vector<UInt> glyphs;
+    {
+        RefPtr<Library> library;
+        RefPtr<Face>    face;
+        Error           err;
+        (library, err) = init_e();
+        if( err )
+            return err;
+
+        (face, err) = library->new_face_e( filepath, 0 );
+        if( !err )
+            mapped_glyphs( face, glyphs );
+        face.unlink();
+        done( library );
+        if( err )
+            return err;
+    }
+
+    if( glyphs.empty() )
+        return 1;
+
+    UInt cores = std::max( 1U, std::thread::hardware_concurrency() );
+    std::printf( "  %u hardware threads\n", cores );
+
+    double base = 0;
+    for( UInt threads=1; threads <= 2*cores && threads <= 64; threads *= 2 )
+    {
+        LibraryPool pool( filepath );
+
+        PoolJob job;
+        job.pool    = &pool;
+        job.glyphs  = &glyphs;
+        job.n_items = 4 * glyphs.size();
+        job.next    = 0;
+        job.failed  = 0;
+
+        // the time includes each thread opening its own library and face
+        double start = now();
+        std::vector<std::thread> workers;
+        for( UInt i=0; i < threads; i++ )
+            workers.push_back( std::thread( render, &job ) );
+        for( UInt i=0; i < threads; i++ )
+            workers[i].join();
+        double rate = job.n_items / ( now() - start );
+
+        if( job.failed )
+            return 1;
+        if( threads == 1 )
+            base = rate;
+
+        std::printf( "  %2u threads  %9.0f glyphs/s  %5.2fx\n",
+                     threads, rate, rate / base );
+    }
+
+    return 0;
+}
+
+} // namespace bench
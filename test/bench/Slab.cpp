@@ -0,0 +1,161 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/Slab.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include "bench.h"
+
+#include <cstdio>
+
+namespace bench {
+
+using namespace freetype;
+
+namespace {
+
+/// MallocAllocator which counts its calls, every one is a C library call
+struct CountingMalloc :
+    MallocAllocator
+{
+    ULong calls;
+
+    CountingMalloc():
+        calls(0)
+    {}
+
+    void* alloc( long size )
+    {
+        ++calls;
+        return MallocAllocator::alloc( size );
+    }
+
+    void free( void* block )
+    {
+        ++calls;
+        MallocAllocator::free( block );
+    }
+
+    void* realloc( long cur_size, long new_size, void* block )
+    {
+        ++calls;
+        return MallocAllocator::realloc( cur_size, new_size, block );
+    }
+};
+
+/// one batch: a library and face of their own, rendering @p count glyphs
+/// at 16 pixels
+Error batch( Memory memory, const char* filepath,
+             const std::vector<UInt>& glyphs, size_t first, size_t count )
+{
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = Library::create_e( memory );
+    if( err )
+        return err;
+    library->add_default_modules();
+
+    (face, err) = library->new_face_e( filepath, 0 );
+    if( !err )
+        err = face->set_pixel_sizes( 0, 16 );
+    for( size_t i=0; !err && i < count; i++ )
+        err = face->load_glyph( glyphs[ (first + i) % glyphs.size() ],
+                                load::RENDER );
+
+    // the library goes with its last reference
+    face.unlink();
+    library.unlink();
+    return err;
+}
+
+const size_t BATCH   = 256;
+const size_t BATCHES = 64;
+
+}
+
+int slab( const char* filepath )
+{
+    std::vector<UInt> glyphs;
+    {
+        RefPtr<Library> library;
+        RefPtr<Face>    face;
+        Error           err;
+        (library, err) = init_e();
+        if( err )
+            return err;
+
+        (face, err) = library->new_face_e( filepath, 0 );
+        if( !err )
+            mapped_glyphs( face, glyphs );
+        face.unlink();
+        done( library );
+        if( err )
+            return err;
+    }
+
+    if( glyphs.empty() )
+        return 1;
+
+    const double n_glyphs = (double)BATCH * BATCHES;
+
+    CountingMalloc counting;
+    Memory         memory = Memory::create( &counting );
+    double         start  = now();
+    for( size_t b=0; b < BATCHES; b++ )
+    {
+        if( batch( memory, filepath, glyphs, b*BATCH, BATCH ) )
+            return 1;
+    }
+    double rate = n_glyphs / ( now() - start );
+    memory.destroy();
+
+    std::printf( "  malloc  %9.0f glyphs/s  %7.1f allocator calls/glyph  "
+                 "%7.1f system calls/glyph\n",
+                 rate, counting.calls / n_glyphs, counting.calls / n_glyphs );
+
+    SlabAllocator slab;
+    memory = Memory::create( &slab );
+    start  = now();
+    for( size_t b=0; b < BATCHES; b++ )
+    {
+        if( batch( memory, filepath, glyphs, b*BATCH, BATCH ) )
+            return 1;
+
+        // every block of the batch is free, rewind the arena
+        if( !slab.reset() )
+            return 1;
+    }
+    rate = n_glyphs / ( now() - start );
+    memory.destroy();
+
+    const SlabAllocator::Stats& stats = slab.stats();
+    ULong calls = stats.alloc_calls + stats.free_calls + stats.realloc_calls;
+    std::printf( "  slab    %9.0f glyphs/s  %7.1f allocator calls/glyph  "
+                 "%7.1f system calls/glyph\n",
+                 rate, calls / n_glyphs, stats.system_calls / n_glyphs );
+
+    return 0;
+}
+
+} // namespace bench
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/bench.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#ifndef CPPFREETYPE_BENCH_H_
+#define CPPFREETYPE_BENCH_H_
+
+#include <cppfreetype/cppfreetype.h>
+
+#include <vector>
+
+/// throughput measurements of the library, run by the bench program
+namespace bench {
+
+/// wall clock time in seconds
+double now();
+
+/// the glyph of every code in the active charmap of @p face, in code order
+void mapped_glyphs( freetype::RefPtr<freetype::Face>& face,
+                    std::vector<freetype::UInt>& out );
+
+/// GlyphAtlas insertion throughput and packing efficiency
+int atlas( const char* filepath );
+
+/// FaceDelegate::load_glyphs against one load_glyph per glyph of a run
+int batch( const char* filepath );
+
+/// decompose() against FT_Outline_Decompose and the outline iterators
+int decompose( const char* filepath );
+
+/// TextLayout against loading and kerning each character in turn
+int layout( const char* filepath );
+
+/// glyph loading throughput of LibraryPool as the thread count grows
+int pool( const char* filepath );
+
+/// RunCache hits against laying the same strings out again
+int runcache( const char* filepath );
+
+/// SlabAllocator against the C library allocator for batches of glyphs
+int slab( const char* filepath );
+
+} // namespace bench
+
+#endif // CPPFREETYPE_BENCH_H_
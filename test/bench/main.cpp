@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/bench/main.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+
+#include "bench.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace bench {
+
+double now()
+{
+    return std::chrono::duration<double>(
+            std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+void mapped_glyphs( freetype::RefPtr<freetype::Face>& face,
+                    std::vector<freetype::UInt>& out )
+{
+    freetype::UInt  glyph = 0;
+    freetype::ULong code  = face->get_first_char( glyph );
+    while( glyph )
+    {
+        out.push_back( glyph );
+        code = face->get_next_char( code, glyph );
+    }
+}
+
+} // namespace bench
+
+namespace {
+
+struct Benchmark
+{
+    const char* name;
+    int       (*run)( const char* filepath );
+};
+
+const Benchmark BENCHMARKS[] =
+{
+    { "atlas",      bench::atlas },
+    { "batch",      bench::batch },
+    { "decompose",  bench::decompose },
+    { "layout",     bench::layout },
+    { "pool",       bench::pool },
+    { "runcache",   bench::runcache },
+    { "slab",       bench::slab },
+};
+
+const size_t NUM_BENCHMARKS = sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]);
+
+}
+
+int main( int argc, char** argv )
+{
+    if( argc < 2 )
+    {
+        std::fprintf( stderr, "usage: %s <font file> [benchmark ...]\n"
+                              "benchmarks:", argv[0] );
+        for( size_t i=0; i < NUM_BENCHMARKS; i++ )
+            std::fprintf( stderr, " %s", BENCHMARKS[i].name );
+        std::fprintf( stderr, "\n" );
+        return 1;
+    }
+
+    int result = 0;
+    for( size_t i=0; i < NUM_BENCHMARKS; i++ )
+    {
+        // run the named benchmarks, or all of them if none are named
+        bool wanted = argc < 3;
+        for( int j=2; j < argc && !wanted; j++ )
+            wanted = std::strcmp( argv[j], BENCHMARKS[i].name ) == 0;
+        if( !wanted )
+            continue;
+
+        std::printf( "%s\n", BENCHMARKS[i].name );
+        if( BENCHMARKS[i].run( argv[1] ) )
+        {
+            std::fprintf( stderr, "%s failed\n", BENCHMARKS[i].name );
+            result = 1;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Bitmap.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstring>
+#include <vector>
+
+namespace unit {
+
+using namespace freetype;
+
+namespace {
+
+/// a view of @p rows rows of @p width pixels at @p buffer
+BitmapView view( const Byte* buffer, Int width, Int rows, Int pitch,
+                 Byte pixel_mode, UShort num_grays = 0 )
+{
+    FT_Bitmap bitmap;
+    std::memset( &bitmap, 0, sizeof(bitmap) );
+    bitmap.buffer     = const_cast<Byte*>( buffer );
+    bitmap.width      = width;
+    bitmap.rows       = rows;
+    bitmap.pitch      = pitch;
+    bitmap.pixel_mode = pixel_mode;
+    bitmap.num_grays  = num_grays;
+    return BitmapView( bitmap );
+}
+
+/// whether row @p j of @p bitmap expands to the @p width values @p expect
+bool row_is( const BitmapView& bitmap, Int j, const Byte* expect )
+{
+    for( Int i=0; i < bitmap.width; i++ )
+    {
+        if( bitmap.coverage( i, j ) != expect[i] )
+            return false;
+    }
+    return true;
+}
+
+}
+
+void bitmap( const char* )
+{
+    UNIT_CHECK( BitmapView().empty() );
+
+    // MONO, most significant bit first, ten pixels spilling into a second
+    // byte and a padding byte at the end of each row
+    const Byte mono[] = { 0xA5, 0x80, 0x00,
+                          0x00, 0x40, 0x00 };
+    const Byte mono_top[]    = { 255, 0, 255, 0, 0, 255, 0, 255, 255, 0 };
+    const Byte mono_bottom[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 255 };
+
+    BitmapView down = view( mono, 10, 2, 3, pixelmode::MONO );
+    UNIT_CHECK( down.stride() == 3 );
+    UNIT_CHECK( down.row(0) == mono && down.row(1) == mono + 3 );
+    UNIT_CHECK( row_is( down, 0, mono_top ) );
+    UNIT_CHECK( row_is( down, 1, mono_bottom ) );
+
+    // the same rows flowing upward, the top row is the last in memory
+    const Byte mono_up[] = { 0x00, 0x40, 0x00,
+                             0xA5, 0x80, 0x00 };
+    BitmapView up = view( mono_up, 10, 2, -3, pixelmode::MONO );
+    UNIT_CHECK( up.stride() == 3 );
+    UNIT_CHECK( up.row(0) == mono_up + 3 && up.row(1) == mono_up );
+    UNIT_CHECK( row_is( up, 0, mono_top ) );
+    UNIT_CHECK( row_is( up, 1, mono_bottom ) );
+
+    // GRAY2 and GRAY4 levels scale to the full range
+    const Byte gray2[]        = { 0x1B, 0xC0 };
+    const Byte gray2_expect[] = { 0, 0x55, 0xAA, 0xFF, 0xFF };
+    UNIT_CHECK( row_is( view( gray2, 5, 1, 2, pixelmode::GRAY2 ), 0,
+                        gray2_expect ) );
+
+    const Byte gray4[]        = { 0x0F, 0x58, 0xA0 };
+    const Byte gray4_expect[] = { 0, 0xFF, 0x55, 0x88, 0xAA };
+    UNIT_CHECK( row_is( view( gray4, 5, 1, 3, pixelmode::GRAY4 ), 0,
+                        gray4_expect ) );
+
+    // GRAY copies 256 levels and scales fewer
+    const Byte gray[]        = { 0, 1, 2, 3, 4 };
+    const Byte gray_expect[] = { 0, 63, 127, 191, 255 };
+    UNIT_CHECK( row_is( view( gray, 5, 1, 5, pixelmode::GRAY, 256 ), 0,
+                        gray ) );
+    UNIT_CHECK( row_is( view( gray, 5, 1, 5, pixelmode::GRAY, 5 ), 0,
+                        gray_expect ) );
+
+    // BGRA expands to alpha
+    const Byte bgra[]        = { 1, 2, 3, 40,  5, 6, 7, 255 };
+    const Byte bgra_expect[] = { 40, 255 };
+    UNIT_CHECK( row_is( view( bgra, 2, 1, 8, pixelmode::BGRA ), 0,
+                        bgra_expect ) );
+
+    // blit_to clips to the image and writes nothing outside it
+    const Int W = 8;
+    const Int H = 3;
+    std::vector<Byte> image( W * H, 7 );
+    up.blit_to( &image[0], W, W, H, -2, 2 );
+    for( Int j=0; j < H; j++ )
+    {
+        for( Int i=0; i < W; i++ )
+        {
+            Byte expect = j < 2 ? 7 : mono_top[ i + 2 ];
+            UNIT_CHECK( image[ j*W + i ] == expect );
+        }
+    }
+
+    // into an image flowing upward, row 0 is the last in memory
+    image.assign( W * H, 7 );
+    view( gray, 5, 1, 5, pixelmode::GRAY, 5 )
+        .blit_to( &image[ (H-1)*W ], -W, W, H, 1, 0 );
+    for( Int i=0; i < W; i++ )
+    {
+        Byte expect = i >= 1 && i < 6 ? gray_expect[ i - 1 ] : 7;
+        UNIT_CHECK( image[ (H-1)*W + i ] == expect );
+        UNIT_CHECK( image[ i ] == 7 );
+    }
+
+    // entirely outside, or empty, writes nothing
+    image.assign( W * H, 7 );
+    down.blit_to( &image[0], W, W, H, W, 0 );
+    down.blit_to( &image[0], W, W, H, 0, -2 );
+    BitmapView().blit_to( &image[0], W, W, H, 0, 0 );
+    UNIT_CHECK( image == std::vector<Byte>( W * H, 7 ) );
+}
+
+} // namespace unit
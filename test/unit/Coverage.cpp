@@ -0,0 +1,209 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Coverage.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace unit {
+
+using namespace freetype;
+
+namespace {
+
+/// whether @p a and @p b hold the same codes, page by page
+bool same( const Coverage& a, const Coverage& b )
+{
+    if( a.count() != b.count() || a.num_pages() != b.num_pages() )
+        return false;
+
+    for( size_t p=0; p < a.num_pages(); p++ )
+    {
+        if( a.pages()[p] != b.pages()[p] )
+            return false;
+    }
+
+    size_t n_words = a.num_pages() * Coverage::PAGE_WORDS;
+    for( size_t w=0; w < n_words; w++ )
+    {
+        if( a.bits()[w] != b.bits()[w] )
+            return false;
+    }
+    return true;
+}
+
+/// whether @p a and @p b describe the same face
+bool same( const FontEntry& a, const FontEntry& b )
+{
+    return a.filepath    == b.filepath
+        && a.face_index  == b.face_index
+        && a.num_faces   == b.num_faces
+        && a.family_name == b.family_name
+        && a.style_name  == b.style_name
+        && a.style_flags == b.style_flags
+        && a.face_flags  == b.face_flags
+        && a.num_glyphs  == b.num_glyphs
+        && a.file_size   == b.file_size
+        && a.mtime_sec   == b.mtime_sec
+        && a.mtime_nsec  == b.mtime_nsec
+        && same( a.coverage, b.coverage );
+}
+
+/// copy the first @p size bytes of @p from to @p to
+bool truncate_copy( const char* from, const char* to, long size )
+{
+    std::FILE* in = std::fopen( from, "rb" );
+    if( !in )
+        return false;
+    std::vector<char> data( size );
+    size_t got = std::fread( &data[0], 1, size, in );
+    std::fclose( in );
+
+    std::FILE* out = std::fopen( to, "wb" );
+    if( !out )
+        return false;
+    std::fwrite( &data[0], 1, got, out );
+    std::fclose( out );
+    return got == (size_t)size;
+}
+
+}
+
+void coverage( const char* filepath )
+{
+    Coverage set;
+    UNIT_CHECK( set.count() == 0 && !set.contains(0) );
+
+    // codes in order, out of order, repeated, and at page edges
+    const ULong CODES[] = { 0x20, 0x41, 0xFF, 0x100, 0x1F600, 0x30, 0x41,
+                            0x10FFFF, 0x0 };
+    for( size_t i=0; i < sizeof(CODES)/sizeof(CODES[0]); i++ )
+        set.add( CODES[i] );
+
+    UNIT_CHECK( set.count() == 8 );
+    UNIT_CHECK( set.num_pages() == 4 );
+    for( size_t i=0; i < sizeof(CODES)/sizeof(CODES[0]); i++ )
+        UNIT_CHECK( set.contains( CODES[i] ) );
+    UNIT_CHECK( !set.contains( 0x42 ) );
+    UNIT_CHECK( !set.contains( 0x101 ) );
+    UNIT_CHECK( !set.contains( 0x1F5FF ) );
+    UNIT_CHECK( !set.contains( 0x200000 ) );
+    for( size_t p=1; p < set.num_pages(); p++ )
+        UNIT_CHECK( set.pages()[p-1] < set.pages()[p] );
+
+    Coverage copy;
+    copy.assign( set.pages(), set.bits(), set.num_pages() );
+    UNIT_CHECK( same( set, copy ) );
+
+    set.clear();
+    UNIT_CHECK( set.count() == 0 && set.num_pages() == 0 );
+    UNIT_CHECK( !set.contains( 0x41 ) );
+
+    // build() holds exactly the codes of the charmap
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    UNIT_CHECK( !err );
+    (face, err) = library->new_face_e( filepath, 0 );
+    UNIT_CHECK( !err );
+    if( !err )
+    {
+        set.build( face );
+
+        size_t n     = 0;
+        UInt   glyph = 0;
+        ULong  code  = face->get_first_char( glyph );
+        ULong  last  = 0;
+        for( ; glyph; code = face->get_next_char( code, glyph ), ++n )
+        {
+            UNIT_CHECK( set.contains( code ) );
+            for( ULong gap = n ? last + 1 : 0; gap < code && gap < 0x30000;
+                    ++gap )
+                UNIT_CHECK( !set.contains( gap ) );
+            last = code;
+        }
+        UNIT_CHECK( n > 0 && set.count() == n );
+    }
+    face.unlink();
+    done( library );
+}
+
+void font_index( const char* filepath )
+{
+    // entries are named by the directory scanned and the file name
+    std::string path( filepath );
+    size_t      slash     = path.rfind('/');
+    std::string directory = slash == std::string::npos
+                          ? std::string(".") : path.substr( 0, slash );
+    std::string indexed   = directory + "/" + path.substr( slash + 1 );
+    std::vector<std::string> directories( 1, directory );
+
+    FontIndex index;
+    UNIT_CHECK( !index.scan( directories, 1 ) );
+    UNIT_CHECK( index.files_opened() > 0 );
+
+    const FontEntry* entry = index.find( indexed.c_str() );
+    UNIT_CHECK( entry );
+    if( entry )
+    {
+        UNIT_CHECK( !entry->family_name.empty() );
+        UNIT_CHECK( entry->coverage.contains( 'A' ) );
+
+        std::vector<size_t> found;
+        index.find_coverage( 'A', found );
+        UNIT_CHECK( !found.empty() );
+    }
+
+    const char* SAVED = "font_index.test";
+    UNIT_CHECK( !index.save( SAVED ) );
+
+    FontIndex loaded;
+    UNIT_CHECK( !loaded.load( SAVED ) );
+    UNIT_CHECK( loaded.size() == index.size() );
+    for( size_t i=0; i < index.size() && i < loaded.size(); i++ )
+        UNIT_CHECK( same( index[i], loaded[i] ) );
+
+    // nothing changed, so rescanning from the loaded index opens no file
+    UNIT_CHECK( !loaded.scan( directories, 1 ) );
+    UNIT_CHECK( loaded.files_opened() == 0 );
+    UNIT_CHECK( loaded.size() == index.size() );
+
+    // a truncated file is refused and leaves the entries alone
+    const char* TRUNCATED = "font_index_truncated.test";
+    UNIT_CHECK( truncate_copy( SAVED, TRUNCATED, 40 ) );
+    UNIT_CHECK( loaded.load( TRUNCATED ) );
+    UNIT_CHECK( loaded.size() == index.size() );
+
+    // and a file which is not an index at all
+    UNIT_CHECK( loaded.load( filepath ) == FT_Err_Unknown_File_Format );
+
+    std::remove( SAVED );
+    std::remove( TRUNCATED );
+}
+
+} // namespace unit
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Filter.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <vector>
+
+namespace unit {
+
+using namespace freetype;
+
+namespace {
+
+/// finalizer of a generic field which does not hold a filter
+void other_finalizer( void* )
+{}
+
+/// codes checked against the charmap, past the planes fonts usually map
+const ULong LAST_CODE = 0x30000;
+
+}
+
+void filter( const char* filepath )
+{
+    // an empty filter rejects everything
+    CoverageFilter empty;
+    UNIT_CHECK( empty.count() == 0 );
+    for( ULong code=0; code < 0x1000; code++ )
+        UNIT_CHECK( !empty.may_contain( code ) );
+
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    UNIT_CHECK( !err );
+    (face, err) = library->new_face_e( filepath, 0 );
+    UNIT_CHECK( !err );
+    if( err )
+    {
+        face.unlink();
+        done( library );
+        return;
+    }
+
+    Coverage coverage;
+    coverage.build( face );
+
+    CoverageFilter from_face;
+    CoverageFilter from_coverage;
+    from_face.build( face );
+    from_coverage.build( coverage, 16 );
+    UNIT_CHECK( from_face.count() == coverage.count() );
+    UNIT_CHECK( from_coverage.count() == coverage.count() );
+    UNIT_CHECK( from_coverage.num_words() >= from_face.num_words() );
+
+    CoverageFilter copy;
+    copy.assign( from_face.words(), from_face.num_words(),
+                 from_face.count() );
+
+    // no mapped code is ever rejected, and few unmapped codes pass
+    size_t missing = 0;
+    size_t passed  = 0;
+    for( ULong code=0; code < LAST_CODE; code++ )
+    {
+        bool mapped = FT_Get_Char_Index( face.subvert(), code ) != 0;
+        UNIT_CHECK( coverage.contains( code ) == mapped );
+        if( mapped )
+        {
+            UNIT_CHECK( from_face.may_contain( code ) );
+            UNIT_CHECK( from_coverage.may_contain( code ) );
+            UNIT_CHECK( copy.may_contain( code ) );
+            continue;
+        }
+
+        ++missing;
+        if( from_face.may_contain( code ) )
+            ++passed;
+        UNIT_CHECK( copy.may_contain( code )
+                        == from_face.may_contain( code ) );
+    }
+    UNIT_CHECK( passed * 20 < missing );
+
+    // attached, get_char_index() answers exactly as FreeType does
+    UNIT_CHECK( !from_face.attach( face ) );
+    UNIT_CHECK( CoverageFilter::attached( face.subvert() ) );
+    for( ULong code=0; code < LAST_CODE; code++ )
+        UNIT_CHECK( face->get_char_index( code )
+                        == FT_Get_Char_Index( face.subvert(), code ) );
+
+    // attaching again replaces the filter
+    UNIT_CHECK( !empty.attach( face ) );
+    UNIT_CHECK( CoverageFilter::attached( face.subvert() )->count() == 0 );
+    UNIT_CHECK( face->get_char_index( 'A' ) == 0 );
+
+    CoverageFilter::detach( face.subvert() );
+    UNIT_CHECK( !CoverageFilter::attached( face.subvert() ) );
+    UNIT_CHECK( face->get_char_index( 'A' ) != 0 );
+
+    // a generic field set by someone else is left alone
+    int owner = 0;
+    face.subvert()->generic.data      = &owner;
+    face.subvert()->generic.finalizer = other_finalizer;
+    UNIT_CHECK( from_face.attach( face ) == FT_Err_Invalid_Argument );
+    UNIT_CHECK( face.subvert()->generic.data == &owner );
+    UNIT_CHECK( !CoverageFilter::attached( face.subvert() ) );
+    face.subvert()->generic.data      = 0;
+    face.subvert()->generic.finalizer = 0;
+
+    face.unlink();
+    done( library );
+}
+
+} // namespace unit
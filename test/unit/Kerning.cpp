@@ -0,0 +1,164 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Kerning.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace unit {
+
+using namespace freetype;
+
+namespace {
+
+void put_ushort( std::vector<Byte>& out, UInt value )
+{
+    out.push_back( (Byte)( value >> 8 ) );
+    out.push_back( (Byte)value );
+}
+
+UInt get_ushort( const Byte* p )
+{
+    return ( p[0] << 8 ) | p[1];
+}
+
+UInt32 get_ulong( const Byte* p )
+{
+    return ( (UInt32)get_ushort(p) << 16 ) | get_ushort(p+2);
+}
+
+/// a horizontal format 0 subtable with @p n pairs of left, right, value
+void put_subtable( std::vector<Byte>& out, UInt coverage,
+                   const Int* pairs, UInt n )
+{
+    put_ushort( out, 0 );
+    put_ushort( out, 14 + 6*n );
+    put_ushort( out, coverage );
+    put_ushort( out, n );
+
+    // searchRange, entrySelector and rangeShift, for n < 4
+    put_ushort( out, n < 2 ? 6 : 12 );
+    put_ushort( out, n < 2 ? 0 : 1 );
+    put_ushort( out, 6*n - ( n < 2 ? 6 : 12 ) );
+    for( UInt i=0; i < n; i++ )
+    {
+        put_ushort( out, pairs[3*i] );
+        put_ushort( out, pairs[3*i+1] );
+        put_ushort( out, (UInt)pairs[3*i+2] & 0xFFFF );
+    }
+}
+
+/// replace the contents of the 'kern' table of the font in @p font with
+/// @p kern, which must not be larger
+bool replace_kern( std::vector<Byte>& font, const std::vector<Byte>& kern )
+{
+    if( font.size() < 12 )
+        return false;
+
+    UInt n_tables = get_ushort( &font[4] );
+    for( UInt i=0; i < n_tables && 12 + 16*(i+1) <= font.size(); i++ )
+    {
+        Byte* entry = &font[ 12 + 16*i ];
+        if( std::memcmp( entry, "kern", 4 ) != 0 )
+            continue;
+
+        UInt32 offset = get_ulong( entry + 8 );
+        UInt32 length = get_ulong( entry + 12 );
+        if( kern.size() > length || offset + length > font.size() )
+            return false;
+
+        std::memcpy( &font[offset], &kern[0], kern.size() );
+        entry[12] = 0;
+        entry[13] = 0;
+        entry[14] = (Byte)( kern.size() >> 8 );
+        entry[15] = (Byte)kern.size();
+        return true;
+    }
+    return false;
+}
+
+}
+
+void kerning( const char* filepath )
+{
+    std::vector<Byte> font;
+    std::FILE* in = std::fopen( filepath, "rb" );
+    UNIT_CHECK( in );
+    if( !in )
+        return;
+    Byte buffer[4096];
+    for( size_t n; ( n = std::fread( buffer, 1, sizeof(buffer), in ) ); )
+        font.insert( font.end(), buffer, buffer + n );
+    std::fclose( in );
+
+    // an additive subtable followed by an override subtable which lists
+    // only one of its pairs
+    const Int additive[] = { 10, 20, -100,
+                             30, 40, -50 };
+    const Int override[] = { 10, 20, -7 };
+
+    std::vector<Byte> kern;
+    put_ushort( kern, 0 );
+    put_ushort( kern, 2 );
+    put_subtable( kern, 0x0001, additive, 2 );
+    put_subtable( kern, 0x0009, override, 1 );
+    UNIT_CHECK( replace_kern( font, kern ) );
+
+    RefPtr<Library> library;
+    RefPtr<Face>    face;
+    Error           err;
+    (library, err) = init_e();
+    UNIT_CHECK( !err );
+    (face, err) = library->new_memory_face_e( &font[0], font.size(), 0 );
+    UNIT_CHECK( !err );
+    if( !err )
+    {
+        KerningTable table;
+        UNIT_CHECK( !table.build( face ) );
+        UNIT_CHECK( table.size() == 2 );
+
+        // each pair as FreeType sees it, the one the override does not
+        // list keeps its summed value
+        const UInt PAIRS[][2] = { { 10, 20 }, { 30, 40 }, { 20, 10 } };
+        for( size_t i=0; i < 3; i++ )
+        {
+            FT_Vector kerning;
+            UNIT_CHECK( !FT_Get_Kerning( face.subvert(), PAIRS[i][0],
+                                         PAIRS[i][1], FT_KERNING_UNSCALED,
+                                         &kerning ) );
+            UNIT_CHECK( table.get( PAIRS[i][0], PAIRS[i][1] )
+                            == kerning.x );
+        }
+        UNIT_CHECK( table.get( 10, 20 ) == -7 );
+        UNIT_CHECK( table.get( 30, 40 ) == -50 );
+    }
+
+    face.unlink();
+    done( library );
+}
+
+} // namespace unit
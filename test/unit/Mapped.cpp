@@ -0,0 +1,95 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Mapped.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace unit {
+
+using namespace freetype;
+
+namespace {
+
+const char* const PATH = "mapped.test";
+
+/// replace the contents of PATH, keeping its inode
+bool rewrite( const char* contents )
+{
+    std::FILE* out = std::fopen( PATH, "wb" );
+    if( !out )
+        return false;
+    std::fwrite( contents, 1, std::strlen(contents), out );
+    std::fclose( out );
+    return true;
+}
+
+}
+
+void mapped( const char* )
+{
+    size_t before = MappedFile::num_mapped();
+    UNIT_CHECK( rewrite( "the first contents of the file" ) );
+
+    RValuePair< MappedFile*, Error > first  = MappedFile::open( PATH );
+    RValuePair< MappedFile*, Error > shared = MappedFile::open( PATH );
+    UNIT_CHECK( !first.p2 && !shared.p2 );
+    if( first.p2 || shared.p2 )
+        return;
+
+    // an unchanged file shares one mapping
+    UNIT_CHECK( first.p1 == shared.p1 );
+    UNIT_CHECK( MappedFile::num_mapped() == before + 1 );
+    shared.p1->release();
+
+    // rewritten in place, shorter, the file is mapped again with its new
+    // size while the old mapping keeps the size it was made with
+    UNIT_CHECK( rewrite( "shorter" ) );
+    RValuePair< MappedFile*, Error > second = MappedFile::open( PATH );
+    UNIT_CHECK( !second.p2 );
+    if( !second.p2 )
+    {
+        UNIT_CHECK( second.p1 != first.p1 );
+        UNIT_CHECK( second.p1->size() == 7 );
+        UNIT_CHECK( std::memcmp( second.p1->data(), "shorter", 7 ) == 0 );
+        UNIT_CHECK( first.p1->size() == 30 );
+
+        // releasing the stale mapping leaves the new one shared
+        first.p1->release();
+        RValuePair< MappedFile*, Error > again = MappedFile::open( PATH );
+        UNIT_CHECK( !again.p2 && again.p1 == second.p1 );
+        if( !again.p2 )
+            again.p1->release();
+        second.p1->release();
+    }
+    else
+        first.p1->release();
+
+    UNIT_CHECK( MappedFile::num_mapped() == before );
+    std::remove( PATH );
+}
+
+} // namespace unit
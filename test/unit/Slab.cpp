@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Slab.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstring>
+
+namespace unit {
+
+using namespace freetype;
+
+void slab( const char* )
+{
+    // every size up to MAX_SMALL has a class which holds it
+    for( UInt c=1; c < SlabAllocator::NUM_CLASSES; c++ )
+        UNIT_CHECK( SlabAllocator::class_size(c-1)
+                        < SlabAllocator::class_size(c) );
+    UNIT_CHECK( SlabAllocator::class_size( SlabAllocator::NUM_CLASSES-1 )
+                    == SlabAllocator::MAX_SMALL );
+
+    SlabAllocator slab( 4096 );
+
+    // blocks of every small size, and a large one, are usable and do not
+    // overlap
+    const long SIZES[] = { 0, 1, 16, 17, 100, 1000, 4096, 4097, 100000 };
+    const int  N       = sizeof(SIZES) / sizeof(SIZES[0]);
+    Byte* blocks[N];
+    for( int i=0; i < N; i++ )
+    {
+        blocks[i] = (Byte*)slab.alloc( SIZES[i] );
+        UNIT_CHECK( blocks[i] );
+        UNIT_CHECK( (size_t)blocks[i] % 16 == 0 );
+        std::memset( blocks[i], i, SIZES[i] );
+    }
+    for( int i=0; i < N; i++ )
+    {
+        for( long j=0; j < SIZES[i]; j++ )
+            UNIT_CHECK( blocks[i][j] == (Byte)i );
+    }
+    UNIT_CHECK( slab.stats().live_blocks == (ULong)N );
+
+    // a live block stops the arena from being rewound
+    UNIT_CHECK( !slab.reset() );
+
+    // a freed block is handed out again for the same size class
+    Byte* freed = blocks[4];
+    slab.free( freed );
+    blocks[4] = (Byte*)slab.alloc( 120 );
+    UNIT_CHECK( blocks[4] == freed );
+
+    // realloc keeps the contents, in place while the class fits and moved
+    // otherwise, small to large and back
+    std::memset( blocks[4], 7, 120 );
+    Byte* grown = (Byte*)slab.realloc( 120, 128, blocks[4] );
+    UNIT_CHECK( grown == blocks[4] );
+    grown = (Byte*)slab.realloc( 128, 8000, grown );
+    UNIT_CHECK( grown != blocks[4] );
+    for( int j=0; j < 120; j++ )
+        UNIT_CHECK( grown[j] == 7 );
+    Byte* shrunk = (Byte*)slab.realloc( 8000, 40, grown );
+    for( int j=0; j < 40; j++ )
+        UNIT_CHECK( shrunk[j] == 7 );
+    blocks[4] = shrunk;
+    UNIT_CHECK( slab.stats().live_blocks == (ULong)N );
+
+    slab.free( 0 );
+    for( int i=0; i < N; i++ )
+        slab.free( blocks[i] );
+    UNIT_CHECK( slab.stats().live_blocks == 0 );
+
+    // once everything is free the chunks are reused from the start
+    ULong reserved = slab.stats().reserved_bytes;
+    ULong system   = slab.stats().system_calls;
+    UNIT_CHECK( slab.reset() );
+    for( int i=0; i < 8; i++ )
+        UNIT_CHECK( slab.alloc( 512 ) );
+    UNIT_CHECK( slab.stats().reserved_bytes == reserved );
+    UNIT_CHECK( slab.stats().system_calls == system );
+
+    slab.reset_stats();
+    UNIT_CHECK( slab.stats().alloc_calls == 0 );
+    UNIT_CHECK( slab.stats().live_blocks == 8 );
+}
+
+} // namespace unit
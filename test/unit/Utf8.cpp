@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Utf8.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstring>
+#include <vector>
+
+namespace unit {
+
+using namespace freetype;
+
+namespace {
+
+/// decode all of @p text, appending each code point and the offset which
+/// follows it
+void decode_all( const char* text, size_t length,
+                 std::vector<UInt32>& codes, std::vector<size_t>& ends )
+{
+    const Byte* bytes = (const Byte*)text;
+    for( size_t i=0; i < length; )
+    {
+        codes.push_back( decode_utf8( bytes, length, i ) );
+        ends.push_back( i );
+    }
+}
+
+/// whether @p text decodes to the @p n code points @p expect
+bool decodes_to( const char* text, const UInt32* expect, size_t n )
+{
+    std::vector<UInt32> codes;
+    std::vector<size_t> ends;
+    decode_all( text, std::strlen(text), codes, ends );
+    return codes == std::vector<UInt32>( expect, expect + n );
+}
+
+const UInt32 BAD = 0xFFFD;
+
+}
+
+void utf8( const char* )
+{
+    // one of each length, at the bounds of each length
+    const UInt32 valid[] = { 0x41, 0x7F, 0x80, 0xE9, 0x7FF, 0x800, 0x20AC,
+                             0xFFFF, 0x10000, 0x1F600, 0x10FFFF };
+    UNIT_CHECK( decodes_to( "A\x7F\xC2\x80\xC3\xA9\xDF\xBF\xE0\xA0\x80"
+                            "\xE2\x82\xAC\xEF\xBF\xBF\xF0\x90\x80\x80"
+                            "\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF",
+                            valid, sizeof(valid) / sizeof(valid[0]) ) );
+
+    // offsets advance past each whole sequence
+    std::vector<UInt32> codes;
+    std::vector<size_t> ends;
+    decode_all( "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", 10, codes, ends );
+    const size_t expect_ends[] = { 1, 3, 6, 10 };
+    UNIT_CHECK( ends == std::vector<size_t>( expect_ends, expect_ends + 4 ) );
+
+    // stray continuation bytes and bytes which start no sequence
+    const UInt32 stray[] = { BAD, 'a', BAD, BAD, 'b' };
+    UNIT_CHECK( decodes_to( "\x80" "a\xFE\xFF" "b", stray, 5 ) );
+
+    // a truncated sequence resumes at the byte which broke it
+    const UInt32 cut[] = { BAD, 'x', BAD, 0xE9 };
+    UNIT_CHECK( decodes_to( "\xE2\x82" "x\xF0\xC3\xA9", cut, 4 ) );
+
+    codes.clear();
+    ends.clear();
+    decode_all( "\xE2\x82", 2, codes, ends );
+    UNIT_CHECK( codes.size() == 1 && codes[0] == BAD && ends[0] == 2 );
+
+    // overlong encodings, surrogates and code points past U+10FFFF
+    const UInt32 rejected[] = { BAD, BAD, BAD, BAD, BAD };
+    UNIT_CHECK( decodes_to( "\xC0\xAF\xE0\x80\xAF\xF0\x80\x80\xAF"
+                            "\xED\xA0\x80\xF4\x90\x80\x80",
+                            rejected, 5 ) );
+}
+
+} // namespace unit
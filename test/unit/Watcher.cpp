@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/Watcher.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace unit {
+
+using namespace freetype;
+
+#ifdef __linux__
+
+namespace {
+
+const char* const ROOT = "watcher.test";
+
+bool copy_file( const char* from, const std::string& to )
+{
+    std::FILE* in  = std::fopen( from, "rb" );
+    std::FILE* out = in ? std::fopen( to.c_str(), "wb" ) : 0;
+    char       buffer[4096];
+    for( size_t n; out && ( n = std::fread( buffer, 1, sizeof(buffer),
+                                            in ) ); )
+        std::fwrite( buffer, 1, n, out );
+    if( in )
+        std::fclose( in );
+    if( out )
+        std::fclose( out );
+    return out != 0;
+}
+
+/// wait for the watcher to publish a snapshot with @p size faces, longer
+/// than it stays quiet before an update
+bool wait_for( FontWatcher& watcher, size_t size )
+{
+    for( int i=0; i < 50; i++ )
+    {
+        if( watcher.snapshot()->size() == size )
+            return true;
+        usleep( 100*1000 );
+    }
+    return false;
+}
+
+/// let the watcher see a change before the next one is made
+void settle()
+{
+    usleep( 500*1000 );
+}
+
+}
+
+void watcher( const char* filepath )
+{
+    std::string root( ROOT );
+    if( std::system( ( "rm -rf " + root ).c_str() ) != 0
+            || mkdir( ROOT, 0755 ) != 0 )
+    {
+        UNIT_CHECK( !"could not create the test directory" );
+        return;
+    }
+
+    std::vector<std::string> directories( 1, root );
+    FontWatcher watcher( directories, 1 );
+    watcher.start( 0 );
+    UNIT_CHECK( watcher.snapshot()->size() == 0 );
+
+    UNIT_CHECK( copy_file( filepath, root + "/top.ttf" ) );
+    UNIT_CHECK( wait_for( watcher, 1 ) );
+
+    // a directory renamed after it is watched, with a subdirectory, still
+    // reports its fonts under the new name
+    UNIT_CHECK( mkdir( ( root + "/a" ).c_str(), 0755 ) == 0 );
+    settle();
+    UNIT_CHECK( mkdir( ( root + "/a/c" ).c_str(), 0755 ) == 0 );
+    settle();
+    UNIT_CHECK( rename( ( root + "/a" ).c_str(),
+                        ( root + "/b" ).c_str() ) == 0 );
+    settle();
+    UNIT_CHECK( copy_file( filepath, root + "/b/x.ttf" ) );
+    UNIT_CHECK( copy_file( filepath, root + "/b/c/y.ttf" ) );
+    UNIT_CHECK( wait_for( watcher, 3 ) );
+    UNIT_CHECK( watcher.snapshot()->find( ( root + "/b/x.ttf" ).c_str() ) );
+    UNIT_CHECK( watcher.snapshot()->find(
+                        ( root + "/b/c/y.ttf" ).c_str() ) );
+
+    UNIT_CHECK( std::remove( ( root + "/b/c/y.ttf" ).c_str() ) == 0 );
+    UNIT_CHECK( wait_for( watcher, 2 ) );
+
+    watcher.stop();
+    UNIT_CHECK( std::system( ( "rm -rf " + root ).c_str() ) == 0 );
+}
+
+#else
+
+void watcher( const char* )
+{}
+
+#endif
+
+} // namespace unit
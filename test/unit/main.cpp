@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/main.cpp
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#include "unit.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+/// number of failed checks
+int g_failures = 0;
+
+struct Test
+{
+    const char* name;
+    bool        needs_font; ///< takes the font file argument
+    void      (*run)( const char* filepath );
+};
+
+const Test TESTS[] =
+{
+    { "bitmap",     false,  unit::bitmap },
+    { "coverage",   true,   unit::coverage },
+    { "filter",     true,   unit::filter },
+    { "font_index", true,   unit::font_index },
+    { "kerning",    true,   unit::kerning },
+    { "mapped",     false,  unit::mapped },
+    { "slab",       false,  unit::slab },
+    { "utf8",       false,  unit::utf8 },
+    { "watcher",    true,   unit::watcher },
+};
+
+const size_t NUM_TESTS = sizeof(TESTS) / sizeof(TESTS[0]);
+
+}
+
+namespace unit {
+
+void fail( const char* file, int line, const char* expr )
+{
+    std::fprintf( stderr, "%s:%d: check failed: %s\n", file, line, expr );
+    ++g_failures;
+}
+
+} // namespace unit
+
+int main( int argc, char** argv )
+{
+    const Test* test = 0;
+    for( size_t i=0; argc > 1 && i < NUM_TESTS; i++ )
+    {
+        if( std::strcmp( argv[1], TESTS[i].name ) == 0 )
+            test = TESTS + i;
+    }
+
+    if( !test || ( test->needs_font && argc < 3 ) )
+    {
+        std::fprintf( stderr, "usage: %s <test> [font file]\n"
+                              "tests:", argv[0] );
+        for( size_t i=0; i < NUM_TESTS; i++ )
+            std::fprintf( stderr, " %s", TESTS[i].name );
+        std::fprintf( stderr, "\n" );
+        return 1;
+    }
+
+    test->run( argc > 2 ? argv[2] : 0 );
+    if( g_failures )
+        std::fprintf( stderr, "%s: %d failed checks\n", test->name,
+                      g_failures );
+    return g_failures ? 1 : 0;
+}
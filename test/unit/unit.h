@@ -0,0 +1,71 @@
+/*
+ *  Copyright (C) 2012 Josh Bialkowski (jbialk@mit.edu)
+ *
+ *  This file is part of cppfreetype.
+ *
+ *  cppfreetype is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  cppfreetype is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with cppfreetype.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ *  @file   test/unit/unit.h
+ *
+ *  @date   Oct 17, 2026
+ *  @author Josh Bialkowski (jbialk@mit.edu)
+ *  @brief
+ */
+#ifndef CPPFREETYPE_UNIT_H_
+#define CPPFREETYPE_UNIT_H_
+
+#include <cppfreetype/cppfreetype.h>
+
+/// record a failure if @p expr is false, and carry on with the test
+#define UNIT_CHECK( expr ) \
+    do { if( !(expr) ) unit::fail( __FILE__, __LINE__, #expr ); } while(0)
+
+/// unit tests of the library, run one at a time by the unit program
+namespace unit {
+
+/// report a failed check and count it
+void fail( const char* file, int line, const char* expr );
+
+/// BitmapView rows of either flow and expansion of every pixel mode
+void bitmap( const char* filepath );
+
+/// Coverage sets, assigned and built from the charmap of a face
+void coverage( const char* filepath );
+
+/// CoverageFilter never rejects a mapped code, attach() and detach()
+void filter( const char* filepath );
+
+/// FontIndex scan of the font's directory, save and load round trip
+void font_index( const char* filepath );
+
+/// KerningTable pairs summed and overridden across subtables the way
+/// FreeType does
+void kerning( const char* filepath );
+
+/// MappedFile sharing, and mapping a file rewritten in place afresh
+void mapped( const char* filepath );
+
+/// SlabAllocator size classes, block reuse, realloc and reset
+void slab( const char* filepath );
+
+/// FontWatcher snapshots following fonts added, removed and renamed
+void watcher( const char* filepath );
+
+/// decode_utf8 of valid, truncated and invalid sequences
+void utf8( const char* filepath );
+
+} // namespace unit
+
+#endif // CPPFREETYPE_UNIT_H_